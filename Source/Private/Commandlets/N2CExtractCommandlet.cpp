@@ -0,0 +1,216 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Commandlets/N2CExtractCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+#include "Core/N2CBlueprintIndex.h"
+#include "Core/N2CGraphCache.h"
+#include "Core/N2CNodeCache.h"
+#include "Core/N2CNodeTranslator.h"
+#include "Core/N2CSerializer.h"
+#include "Engine/Blueprint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utils/N2CLogger.h"
+
+UN2CExtractCommandlet::UN2CExtractCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Writes the Node to Code JSON of every Blueprint under the given content paths");
+    HelpUsage = TEXT("-run=N2CExtract [-Paths=/Game/A+/Game/B] [-Output=<Dir>] [-BatchSize=32]");
+}
+
+int32 UN2CExtractCommandlet::Main(const FString& Params)
+{
+    FString PathsParam = TEXT("/Game");
+    FParse::Value(*Params, TEXT("Paths="), PathsParam);
+
+    TArray<FString> ContentPaths;
+    PathsParam.ParseIntoArray(ContentPaths, TEXT("+"), true);
+
+    FString OutputDir = FPaths::ProjectSavedDir() / TEXT("NodeToCode") / TEXT("Extract");
+    FParse::Value(*Params, TEXT("Output="), OutputDir);
+    OutputDir = FPaths::ConvertRelativePathToFull(OutputDir);
+
+    int32 BatchSize = 32;
+    FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+    BatchSize = FMath::Max(BatchSize, 1);
+
+    TArray<FAssetData> Assets;
+    FindBlueprints(ContentPaths, Assets);
+
+    FN2CLogger::Get().Log(TEXT("Starting Blueprint extraction"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d Blueprints under %s, writing to %s"), Assets.Num(), *PathsParam, *OutputDir));
+
+    if (Assets.Num() == 0)
+    {
+        return 0;
+    }
+
+    // The index is refreshed along the way, so call graph queries cover everything extracted
+    FN2CBlueprintIndex& Index = FN2CBlueprintIndex::Get();
+    Index.Load();
+
+    // Nothing reads the files but tools, so skip the indentation
+    FN2CSerializer::SetPrettyPrint(false);
+
+    FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 NumWritten = 0;
+    int32 NumFailed = 0;
+    int32 NumSkipped = 0;
+    int64 BytesWritten = 0;
+
+    // Writes of the previous batch overlap with loading the current one
+    TArray<TFuture<int64>> PreviousWrites;
+    TArray<TFuture<int64>> CurrentWrites;
+
+    auto WaitForWrites = [&NumWritten, &NumFailed, &BytesWritten](TArray<TFuture<int64>>& Writes)
+    {
+        for (TFuture<int64>& Write : Writes)
+        {
+            const int64 Bytes = Write.Get();
+            if (Bytes >= 0)
+            {
+                ++NumWritten;
+                BytesWritten += Bytes;
+            }
+            else
+            {
+                ++NumFailed;
+            }
+        }
+        Writes.Reset();
+    };
+
+    for (int32 BatchStart = 0; BatchStart < Assets.Num(); BatchStart += BatchSize)
+    {
+        const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Assets.Num());
+
+        // Queue the whole batch so the async loader can overlap package I/O, then wait once
+        for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+        {
+            LoadPackageAsync(Assets[AssetIndex].PackageName.ToString());
+        }
+        FlushAsyncLoading();
+
+        for (int32 AssetIndex = BatchStart; AssetIndex < BatchEnd; ++AssetIndex)
+        {
+            const FAssetData& Asset = Assets[AssetIndex];
+
+            UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
+            if (!Blueprint)
+            {
+                FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Failed to load %s"), *Asset.PackageName.ToString()));
+                ++NumFailed;
+                continue;
+            }
+
+            FN2CTranslationSession Session;
+            if (!Translator.GenerateN2CStructForBlueprint(Session, Blueprint))
+            {
+                // Data-only Blueprints and Blueprints with only empty graphs have nothing to extract
+                if (Session.GetN2CBlueprint().Graphs.Num() == 0)
+                {
+                    FN2CLogger::Get().Log(FString::Printf(TEXT("Skipped %s, no translatable graphs"), *Asset.PackageName.ToString()),
+                        EN2CLogSeverity::Debug);
+                    ++NumSkipped;
+                    continue;
+                }
+
+                FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Failed to translate %s"), *Asset.PackageName.ToString()));
+                ++NumFailed;
+                continue;
+            }
+
+            // The index reads the graphs before any passes; the node cache makes the second translation cheap
+            Index.IndexBlueprint(Blueprint);
+
+            // The session ends with this iteration, so its result moves to the worker
+            CurrentWrites.Add(Async(EAsyncExecution::ThreadPool,
+                [N2CBlueprint = Session.TakeN2CBlueprint(), FilePath = GetOutputFilePath(OutputDir, Asset)]() -> int64
+                {
+                    const FString Json = FN2CSerializer::ToJson(N2CBlueprint);
+                    if (Json.IsEmpty())
+                    {
+                        return INDEX_NONE;
+                    }
+
+                    FTCHARToUTF8 Utf8Json(*Json);
+                    const TArrayView<const uint8> Bytes(reinterpret_cast<const uint8*>(Utf8Json.Get()), Utf8Json.Length());
+                    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+                    {
+                        FN2CLogger::Get().LogError(FString::Printf(TEXT("Failed to write %s"), *FilePath));
+                        return INDEX_NONE;
+                    }
+
+                    return Utf8Json.Length();
+                }));
+        }
+
+        // Release the batch's packages; their nodes will not be translated again
+        FN2CNodeCache::Get().Clear();
+        FN2CGraphCache::Get().Clear();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        WaitForWrites(PreviousWrites);
+        Swap(PreviousWrites, CurrentWrites);
+
+        FN2CLogger::Get().Log(FString::Printf(TEXT("Extracted %d / %d Blueprints"), BatchEnd, Assets.Num()), EN2CLogSeverity::Info);
+    }
+
+    WaitForWrites(PreviousWrites);
+    Index.Save();
+
+    const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_SMALL_NUMBER);
+    FN2CLogger::Get().Log(TEXT("Blueprint extraction complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d written, %d skipped without translatable graphs, %d failed in %.2f s (%.1f assets/s), %lld bytes written (%.2f MB/s)"),
+            NumWritten,
+            NumSkipped,
+            NumFailed,
+            Elapsed,
+            NumWritten / Elapsed,
+            BytesWritten,
+            BytesWritten / (1024.0 * 1024.0) / Elapsed));
+
+    return NumFailed > 0 ? 1 : 0;
+}
+
+void UN2CExtractCommandlet::FindBlueprints(const TArray<FString>& ContentPaths, TArray<FAssetData>& OutAssets) const
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+    AssetRegistry.SearchAllAssets(true);
+
+    // Widget, animation and other Blueprint subclasses are included
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    Filter.bRecursivePaths = true;
+    for (const FString& ContentPath : ContentPaths)
+    {
+        Filter.PackagePaths.Add(FName(*ContentPath));
+    }
+
+    AssetRegistry.GetAssets(Filter, OutAssets);
+
+    // Stable order keeps batches and logs comparable between runs
+    OutAssets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+}
+
+FString UN2CExtractCommandlet::GetOutputFilePath(const FString& OutputDir, const FAssetData& Asset)
+{
+    FString RelativePath = Asset.PackageName.ToString();
+    RelativePath.RemoveFromStart(TEXT("/"));
+    return OutputDir / RelativePath + TEXT(".json");
+}
@@ -0,0 +1,514 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CBlueprintIndex.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Core/N2CNodeTranslator.h"
+#include "Core/N2CSettings.h"
+#include "Core/N2CTranslationJob.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "Utils/N2CGraphHasher.h"
+#include "Utils/N2CLogger.h"
+
+namespace N2CBlueprintIndex
+{
+    /** Version of the index file format */
+    constexpr int32 FileVersion = 2;
+
+    /** Whether a node calls a function that may be a Blueprint graph */
+    bool IsCallNode(EN2CNodeType NodeType)
+    {
+        return NodeType == EN2CNodeType::CallFunction
+            || NodeType == EN2CNodeType::CallFunctionOnMember
+            || NodeType == EN2CNodeType::CallParentFunction;
+    }
+}
+
+FN2CBlueprintIndex& FN2CBlueprintIndex::Get()
+{
+    static FN2CBlueprintIndex Instance;
+    return Instance;
+}
+
+void FN2CBlueprintIndex::Initialize()
+{
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    if (!Settings || !Settings->bMaintainBlueprintIndex)
+    {
+        return;
+    }
+
+    Load();
+
+    if (!PackageSavedHandle.IsValid())
+    {
+        PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FN2CBlueprintIndex::HandlePackageSaved);
+    }
+
+    if (!AssetRemovedHandle.IsValid())
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+        AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FN2CBlueprintIndex::HandleAssetRemoved);
+    }
+
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FN2CBlueprintIndex::Tick));
+    }
+}
+
+void FN2CBlueprintIndex::Shutdown()
+{
+    if (PackageSavedHandle.IsValid())
+    {
+        UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+        PackageSavedHandle.Reset();
+    }
+
+    if (AssetRemovedHandle.IsValid())
+    {
+        if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+        {
+            AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+        }
+        AssetRemovedHandle.Reset();
+    }
+
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    PendingBlueprints.Empty();
+
+    if (RefreshJob.IsValid())
+    {
+        RefreshJob->Shutdown();
+        RefreshJob.Reset();
+    }
+
+    if (bDirty)
+    {
+        Save();
+    }
+}
+
+void FN2CBlueprintIndex::QueueBlueprint(UBlueprint* Blueprint)
+{
+    if (Blueprint)
+    {
+        PendingBlueprints.AddUnique(Blueprint);
+    }
+}
+
+bool FN2CBlueprintIndex::IndexBlueprint(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return false;
+    }
+
+    FN2CTranslationSession Session;
+    Session.SetRawGraphs(true);
+    const bool bTranslated = FN2CNodeTranslator::Get().GenerateN2CStructForBlueprint(Session, Blueprint);
+
+    // A Blueprint left without graphs drops out of the index
+    UpdateBlueprint(Blueprint, Session.GetN2CBlueprint());
+    return bTranslated;
+}
+
+void FN2CBlueprintIndex::UpdateBlueprint(const UBlueprint* Blueprint, const FN2CBlueprint& N2CBlueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    const FString Package = Blueprint->GetPackage()->GetName();
+    RemovePackage(Package);
+
+    TMap<FString, const UEdGraph*> OwnedGraphs;
+    auto AddOwnedGraphs = [&OwnedGraphs](const TArray<TObjectPtr<UEdGraph>>& InGraphs)
+    {
+        for (const UEdGraph* Graph : InGraphs)
+        {
+            if (Graph)
+            {
+                OwnedGraphs.Add(Graph->GetName(), Graph);
+            }
+        }
+    };
+    AddOwnedGraphs(Blueprint->UbergraphPages);
+    AddOwnedGraphs(Blueprint->FunctionGraphs);
+    AddOwnedGraphs(Blueprint->MacroGraphs);
+    AddOwnedGraphs(Blueprint->DelegateSignatureGraphs);
+
+    TArray<FString> CalleeKeys;
+    for (const FN2CGraph& Graph : N2CBlueprint.Graphs)
+    {
+        // Owned graphs are translated first; later graphs of the same name were pulled in from other Blueprints
+        const UEdGraph* OwnedGraph = nullptr;
+        if (!OwnedGraphs.RemoveAndCopyValue(Graph.Name, OwnedGraph))
+        {
+            continue;
+        }
+
+        CalleeKeys.Reset();
+        for (const FN2CNodeDefinition& Node : Graph.Nodes)
+        {
+            if (N2CBlueprintIndex::IsCallNode(Node.NodeType) && !Node.MemberName.IsEmpty())
+            {
+                CalleeKeys.AddUnique(MakeKey(Node.GetCleanMemberParent(), Node.MemberName));
+            }
+        }
+
+        AddGraph(MakeKey(N2CBlueprint.Metadata.BlueprintClass, Graph.Name), Package, OwnedGraph->GetPathName(), Graph.BodyHash, CalleeKeys);
+    }
+
+    bDirty = true;
+}
+
+void FN2CBlueprintIndex::RemovePackage(const FString& PackageName)
+{
+    TArray<int32> GraphIdsInPackage;
+    if (!PackageGraphs.RemoveAndCopyValue(PackageName, GraphIdsInPackage))
+    {
+        return;
+    }
+
+    for (const int32 GraphId : GraphIdsInPackage)
+    {
+        FGraphEntry& Entry = Graphs[GraphId];
+        for (const int32 Callee : Entry.Callees)
+        {
+            Graphs[Callee].Callers.RemoveSwap(GraphId);
+        }
+
+        // The entry stays as a call target for graphs that still reference it
+        Entry.Callees.Reset();
+        Entry.Package.Reset();
+        Entry.GraphPath.Reset();
+        Entry.ContentHash = 0;
+        --NumIndexed;
+    }
+
+    bDirty = true;
+}
+
+const FN2CBlueprintIndex::FGraphEntry* FN2CBlueprintIndex::FindGraph(const FString& Key) const
+{
+    const int32* GraphId = GraphIds.Find(Key);
+    return GraphId ? &Graphs[*GraphId] : nullptr;
+}
+
+void FN2CBlueprintIndex::GetCallees(const FString& Key, TArray<FString>& OutKeys) const
+{
+    if (const FGraphEntry* Entry = FindGraph(Key))
+    {
+        for (const int32 Callee : Entry->Callees)
+        {
+            OutKeys.Add(Graphs[Callee].Key);
+        }
+    }
+}
+
+void FN2CBlueprintIndex::GetCallers(const FString& Key, TArray<FString>& OutKeys) const
+{
+    if (const FGraphEntry* Entry = FindGraph(Key))
+    {
+        for (const int32 Caller : Entry->Callers)
+        {
+            OutKeys.Add(Graphs[Caller].Key);
+        }
+    }
+}
+
+void FN2CBlueprintIndex::GetTransitiveCallees(const FString& Key, TArray<FString>& OutKeys) const
+{
+    GetReachable(Key, true, OutKeys);
+}
+
+void FN2CBlueprintIndex::GetTransitiveCallers(const FString& Key, TArray<FString>& OutKeys) const
+{
+    GetReachable(Key, false, OutKeys);
+}
+
+bool FN2CBlueprintIndex::Load()
+{
+    Graphs.Reset();
+    GraphIds.Reset();
+    PackageGraphs.Reset();
+    NumIndexed = 0;
+    bDirty = false;
+
+    const FString FilePath = GetIndexFilePath();
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> RootObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, RootObject) || !RootObject.IsValid())
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Failed to parse Blueprint index, it will be rebuilt"), FilePath);
+        return false;
+    }
+
+    int32 Version = 0;
+    if (!RootObject->TryGetNumberField(TEXT("version"), Version) || Version != N2CBlueprintIndex::FileVersion)
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Blueprint index has an unsupported version, it will be rebuilt"), FilePath);
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* BlueprintValues = nullptr;
+    if (RootObject->TryGetArrayField(TEXT("blueprints"), BlueprintValues))
+    {
+        TArray<FString> CalleeKeys;
+        for (const TSharedPtr<FJsonValue>& BlueprintValue : *BlueprintValues)
+        {
+            const TSharedPtr<FJsonObject> BlueprintObject = BlueprintValue->AsObject();
+            const TArray<TSharedPtr<FJsonValue>>* GraphValues = nullptr;
+            FString Package;
+            if (!BlueprintObject.IsValid()
+                || !BlueprintObject->TryGetStringField(TEXT("package"), Package)
+                || !BlueprintObject->TryGetArrayField(TEXT("graphs"), GraphValues))
+            {
+                continue;
+            }
+
+            for (const TSharedPtr<FJsonValue>& GraphValue : *GraphValues)
+            {
+                const TSharedPtr<FJsonObject> GraphObject = GraphValue->AsObject();
+                if (!GraphObject.IsValid())
+                {
+                    continue;
+                }
+
+                CalleeKeys.Reset();
+                GraphObject->TryGetStringArrayField(TEXT("calls"), CalleeKeys);
+
+                const uint64 ContentHash = FN2CGraphHasher::HashFromString(GraphObject->GetStringField(TEXT("hash")));
+                AddGraph(GraphObject->GetStringField(TEXT("key")), Package, GraphObject->GetStringField(TEXT("path")), ContentHash, CalleeKeys);
+            }
+        }
+    }
+
+    FN2CLogger::Get().Log(TEXT("Blueprint index loaded"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d graphs in %d Blueprints"), NumIndexed, PackageGraphs.Num()));
+    return true;
+}
+
+bool FN2CBlueprintIndex::Save()
+{
+    TArray<TSharedPtr<FJsonValue>> BlueprintValues;
+    for (const TPair<FString, TArray<int32>>& Pair : PackageGraphs)
+    {
+        TArray<TSharedPtr<FJsonValue>> GraphValues;
+        for (const int32 GraphId : Pair.Value)
+        {
+            const FGraphEntry& Entry = Graphs[GraphId];
+
+            TArray<TSharedPtr<FJsonValue>> CalleeValues;
+            for (const int32 Callee : Entry.Callees)
+            {
+                CalleeValues.Add(MakeShared<FJsonValueString>(Graphs[Callee].Key));
+            }
+
+            TSharedPtr<FJsonObject> GraphObject = MakeShared<FJsonObject>();
+            GraphObject->SetStringField(TEXT("key"), Entry.Key);
+            GraphObject->SetStringField(TEXT("path"), Entry.GraphPath);
+            GraphObject->SetStringField(TEXT("hash"), FN2CGraphHasher::HashToString(Entry.ContentHash));
+            GraphObject->SetArrayField(TEXT("calls"), CalleeValues);
+            GraphValues.Add(MakeShared<FJsonValueObject>(GraphObject));
+        }
+
+        TSharedPtr<FJsonObject> BlueprintObject = MakeShared<FJsonObject>();
+        BlueprintObject->SetStringField(TEXT("package"), Pair.Key);
+        BlueprintObject->SetArrayField(TEXT("graphs"), GraphValues);
+        BlueprintValues.Add(MakeShared<FJsonValueObject>(BlueprintObject));
+    }
+
+    TSharedPtr<FJsonObject> RootObject = MakeShared<FJsonObject>();
+    RootObject->SetNumberField(TEXT("version"), N2CBlueprintIndex::FileVersion);
+    RootObject->SetArrayField(TEXT("blueprints"), BlueprintValues);
+
+    FString JsonString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+    if (!FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer))
+    {
+        FN2CLogger::Get().LogError(TEXT("Failed to serialize Blueprint index"));
+        return false;
+    }
+
+    const FString FilePath = GetIndexFilePath();
+    if (!FFileHelper::SaveStringToFile(JsonString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        FN2CLogger::Get().LogError(TEXT("Failed to write Blueprint index"), FilePath);
+        return false;
+    }
+
+    bDirty = false;
+    FN2CLogger::Get().Log(TEXT("Blueprint index saved"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d graphs in %d Blueprints"), NumIndexed, PackageGraphs.Num()));
+    return true;
+}
+
+FString FN2CBlueprintIndex::MakeKey(const FString& ClassName, const FString& GraphName)
+{
+    return ClassName + TEXT(".") + GraphName;
+}
+
+int32 FN2CBlueprintIndex::FindOrAddGraph(const FString& Key)
+{
+    if (const int32* GraphId = GraphIds.Find(Key))
+    {
+        return *GraphId;
+    }
+
+    const int32 GraphId = Graphs.AddDefaulted();
+    Graphs[GraphId].Key = Key;
+    GraphIds.Add(Key, GraphId);
+    return GraphId;
+}
+
+void FN2CBlueprintIndex::AddGraph(const FString& Key, const FString& Package, const FString& GraphPath, uint64 ContentHash, const TArray<FString>& CalleeKeys)
+{
+    // Resolve IDs first, adding entries may reallocate the graph array
+    TArray<int32> CalleeIds;
+    CalleeIds.Reserve(CalleeKeys.Num());
+    for (const FString& CalleeKey : CalleeKeys)
+    {
+        CalleeIds.AddUnique(FindOrAddGraph(CalleeKey));
+    }
+
+    const int32 GraphId = FindOrAddGraph(Key);
+
+    // Two Blueprints with the same class name; the most recent one wins
+    if (Graphs[GraphId].IsIndexed())
+    {
+        const FString PreviousPackage = Graphs[GraphId].Package;
+        FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Blueprint index: %s is defined in both %s and %s"),
+            *Key, *PreviousPackage, *Package));
+        RemovePackage(PreviousPackage);
+    }
+
+    FGraphEntry& Entry = Graphs[GraphId];
+    Entry.Package = Package;
+    Entry.GraphPath = GraphPath;
+    Entry.ContentHash = ContentHash;
+    Entry.Callees = MoveTemp(CalleeIds);
+
+    for (const int32 Callee : Entry.Callees)
+    {
+        Graphs[Callee].Callers.Add(GraphId);
+    }
+
+    PackageGraphs.FindOrAdd(Package).Add(GraphId);
+    ++NumIndexed;
+}
+
+void FN2CBlueprintIndex::GetReachable(const FString& Key, bool bCallees, TArray<FString>& OutKeys) const
+{
+    const int32* StartId = GraphIds.Find(Key);
+    if (!StartId)
+    {
+        return;
+    }
+
+    TBitArray<> Visited(false, Graphs.Num());
+    Visited[*StartId] = true;
+
+    TArray<int32> Queue;
+    Queue.Add(*StartId);
+
+    for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+    {
+        const FGraphEntry& Entry = Graphs[Queue[QueueIndex]];
+        for (const int32 Next : bCallees ? Entry.Callees : Entry.Callers)
+        {
+            // Native functions are call targets only and have no graph to continue into
+            if (!Visited[Next] && Graphs[Next].IsIndexed())
+            {
+                Visited[Next] = true;
+                OutKeys.Add(Graphs[Next].Key);
+                Queue.Add(Next);
+            }
+        }
+    }
+}
+
+FString FN2CBlueprintIndex::GetIndexFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("NodeToCode") / TEXT("BlueprintIndex.json");
+}
+
+void FN2CBlueprintIndex::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+    if (!Package || ObjectSaveContext.IsProceduralSave())
+    {
+        return;
+    }
+
+    ForEachObjectWithPackage(Package, [this](UObject* Object)
+    {
+        QueueBlueprint(Cast<UBlueprint>(Object));
+        return true;
+    }, false);
+}
+
+void FN2CBlueprintIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    RemovePackage(AssetData.PackageName.ToString());
+}
+
+bool FN2CBlueprintIndex::Tick(float DeltaTime)
+{
+    // One Blueprint at a time, each in a quiet job that keeps the editor responsive
+    if (RefreshJob.IsValid() && RefreshJob->IsRunning())
+    {
+        return true;
+    }
+
+    UBlueprint* Blueprint = nullptr;
+    while (!Blueprint && PendingBlueprints.Num() > 0)
+    {
+        Blueprint = PendingBlueprints[0].Get();
+        PendingBlueprints.RemoveAt(0);
+    }
+
+    if (!Blueprint)
+    {
+        return true;
+    }
+
+    // Raw graphs keep every call node under its own graph, and depth 0 leaves other Blueprints to their own entries
+    RefreshJob = MakeShared<FN2CTranslationJob>(FText::FromString(Blueprint->GetName()),
+        FOnN2CTranslationJobFinished::CreateLambda([this, WeakBlueprint = TWeakObjectPtr<UBlueprint>(Blueprint)](bool bSuccess, FN2CTranslationSession& Session)
+        {
+            // A Blueprint left without graphs drops out of the index
+            if (bSuccess || Session.GetN2CBlueprint().Graphs.Num() == 0)
+            {
+                UpdateBlueprint(WeakBlueprint.Get(), Session.GetN2CBlueprint());
+            }
+        }));
+    RefreshJob->SetShowNotification(false);
+    RefreshJob->SetRawGraphs(true);
+    RefreshJob->StartBlueprintTranslation(Blueprint);
+
+    return true;
+}
@@ -3,6 +3,7 @@
 #include "Core/N2CEditorIntegration.h"
 
 #include "BlueprintEditorModes.h"
+#include "Core/N2CBlueprintIndex.h"
 #include "Core/N2CNodeCollector.h"
 #include "BlueprintEditorModule.h"
 #include "Code Editor/Models/N2CCodeLanguage.h"
@@ -10,7 +11,9 @@
 #include "Core/N2CNodeTranslator.h"
 #include "Core/N2CSerializer.h"
 #include "Core/N2CSettings.h"
+#include "Core/N2CSpeculativeTranslation.h"
 #include "Core/N2CToolbarCommand.h"
+#include "Core/N2CTranslationJob.h"
 #include "LLM/N2CLLMModule.h"
 #include "LLM/N2CLLMTypes.h"
 #include "Framework/Notifications/NotificationManager.h"
@@ -73,16 +76,14 @@ void FN2CEditorIntegration::ExecuteCopyJsonForEditor(TWeakPtr<FBlueprintEditor>
         FString Context = FString::Printf(TEXT("Collected %d nodes"), CollectedNodes.Num());
         FN2CLogger::Get().Log(TEXT("Node collection successful"), EN2CLogSeverity::Info, Context);
 
-        // Get translator instance                                                                                                                                                                        
-        FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
-
-        // Generate N2CStruct from collected nodes
-        if (Translator.GenerateN2CStruct(CollectedNodes))
+        // Generate N2CStruct from collected nodes in a session of its own
+        FN2CTranslationSession Session;
+        if (FN2CNodeTranslator::Get().GenerateN2CStruct(Session, CollectedNodes))
         {
             FN2CLogger::Get().Log(TEXT("Node translation successful"), EN2CLogSeverity::Info);
 
             // Get the Blueprint structure
-            const FN2CBlueprint& Blueprint = FN2CNodeTranslator::Get().GetN2CBlueprint();
+            const FN2CBlueprint& Blueprint = Session.GetN2CBlueprint();
 
             // Validate the generated Blueprint
             if (Blueprint.IsValid())
@@ -158,6 +159,13 @@ void FN2CEditorIntegration::Shutdown()
     // Unregister tab spawner
     SN2CEditorWindow::UnregisterTabSpawner();
 
+    // Stop any translation still running
+    if (ActiveJob.IsValid())
+    {
+        ActiveJob->Shutdown();
+        ActiveJob.Reset();
+    }
+
     // Clear editor command lists
     EditorCommandLists.Empty();
 
@@ -228,6 +236,9 @@ void FN2CEditorIntegration::HandleAssetEditorOpened(UObject* Asset, IAssetEditor
                 EN2CLogSeverity::Debug
             );
         }
+
+        // Get the Blueprint's translation ready before it is asked for
+        FN2CSpeculativeTranslation::Get().Prepare(OpenedBlueprint);
     }
 }
 
@@ -301,6 +312,51 @@ void FN2CEditorIntegration::RegisterToolbarForEditor(TSharedPtr<FBlueprintEditor
         })
     );
     
+    // Map the Translate Selection command
+    CommandList->MapAction(
+        FN2CToolbarCommand::Get().TranslateSelectionCommand,
+        FExecuteAction::CreateLambda([this, WeakEditor, BlueprintName]()
+        {
+            FN2CLogger::Get().Log(
+                FString::Printf(TEXT("Node to Code selection translation triggered for Blueprint: %s"), *BlueprintName),
+                EN2CLogSeverity::Info
+            );
+            ExecuteTranslateSelectionForEditor(WeakEditor);
+        }),
+        FCanExecuteAction::CreateLambda([WeakEditor]()
+        {
+            TSharedPtr<FBlueprintEditor> Editor = WeakEditor.Pin();
+            if (!Editor.IsValid())
+            {
+                return false;
+            }
+            return Editor->GetCurrentMode() == FBlueprintEditorApplicationModes::StandardBlueprintEditorMode
+                && Editor->GetSelectedNodes().Num() > 0;
+        })
+    );
+    
+    // Map the Translate Blueprint command
+    CommandList->MapAction(
+        FN2CToolbarCommand::Get().TranslateBlueprintCommand,
+        FExecuteAction::CreateLambda([this, WeakEditor, BlueprintName]()
+        {
+            FN2CLogger::Get().Log(
+                FString::Printf(TEXT("Node to Code whole-Blueprint translation triggered for Blueprint: %s"), *BlueprintName),
+                EN2CLogSeverity::Info
+            );
+            ExecuteTranslateBlueprintForEditor(WeakEditor);
+        }),
+        FCanExecuteAction::CreateLambda([WeakEditor]()
+        {
+            TSharedPtr<FBlueprintEditor> Editor = WeakEditor.Pin();
+            if (!Editor.IsValid())
+            {
+                return false;
+            }
+            return Editor->GetCurrentMode() == FBlueprintEditorApplicationModes::StandardBlueprintEditorMode;
+        })
+    );
+    
     // Map the Copy JSON command
     CommandList->MapAction(
         FN2CToolbarCommand::Get().CopyJsonCommand,
@@ -349,6 +405,8 @@ void FN2CEditorIntegration::RegisterToolbarForEditor(TSharedPtr<FBlueprintEditor
                     
                     MenuBuilder.AddMenuEntry(FN2CToolbarCommand::Get().OpenWindowCommand);
                     MenuBuilder.AddMenuEntry(FN2CToolbarCommand::Get().CollectNodesCommand);
+                    MenuBuilder.AddMenuEntry(FN2CToolbarCommand::Get().TranslateSelectionCommand);
+                    MenuBuilder.AddMenuEntry(FN2CToolbarCommand::Get().TranslateBlueprintCommand);
                     MenuBuilder.AddMenuEntry(FN2CToolbarCommand::Get().CopyJsonCommand);
 
                     return MenuBuilder.MakeWidget();
@@ -408,8 +466,7 @@ FName FN2CEditorIntegration::GetDefaultTheme(EN2CCodeLanguage Language) const
 void FN2CEditorIntegration::ExecuteCollectNodesForEditor(TWeakPtr<FBlueprintEditor> InEditor)
 {
     // Check if translation is already in progress
-    UN2CLLMModule* LLMModule = UN2CLLMModule::Get();
-    if (LLMModule && LLMModule->GetSystemStatus() == EN2CSystemStatus::Processing)
+    if (IsTranslationInProgress())
     {
         FN2CLogger::Get().LogWarning(TEXT("Translation already in progress, please wait"));
         return;
@@ -460,89 +517,239 @@ void FN2CEditorIntegration::ExecuteCollectNodesForEditor(TWeakPtr<FBlueprintEdit
         FString Context = FString::Printf(TEXT("Collected %d nodes"), CollectedNodes.Num());
         FN2CLogger::Get().Log(TEXT("Node collection successful"), EN2CLogSeverity::Info, Context);
         
-        // Get translator instance                                                                                                                                                                        
-        FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+        // Generate N2CStruct from collected nodes over the next frames
+        ActiveJob = MakeShared<FN2CTranslationJob>(FText::FromString(GraphName),
+            FOnN2CTranslationJobFinished::CreateLambda([this](bool bSuccess, FN2CTranslationSession& Session)
+            {
+                if (bSuccess)
+                {
+                    FN2CLogger::Get().Log(TEXT("Node translation successful"), EN2CLogSeverity::Info);
+
+                    SubmitTranslation(UN2CLLMModule::Get(), Session.GetN2CBlueprint());
+                }
+                else
+                {
+                    FN2CLogger::Get().LogError(TEXT("Failed to translate nodes"));
+                }
+            }));
+        ActiveJob->StartNodeTranslation(CollectedNodes);
+    }
+}
+
+void FN2CEditorIntegration::ExecuteTranslateSelectionForEditor(TWeakPtr<FBlueprintEditor> InEditor)
+{
+    // Check if translation is already in progress
+    if (IsTranslationInProgress())
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Translation already in progress, please wait"));
+        return;
+    }
+
+    FN2CLogger::Get().Log(TEXT("ExecuteTranslateSelectionForEditor called"), EN2CLogSeverity::Debug);
+
+    // Show the window as a tab
+    FGlobalTabmanager::Get()->TryInvokeTab(SN2CEditorWindow::TabId);
+
+    // Get the editor pointer
+    TSharedPtr<FBlueprintEditor> Editor = InEditor.Pin();
+    if (!Editor.IsValid())
+    {
+        FN2CLogger::Get().LogError(TEXT("Invalid Blueprint Editor pointer"));
+        return;
+    }
+
+    UEdGraph* FocusedGraph = Editor->GetFocusedGraph();
+    if (!FocusedGraph)
+    {
+        FN2CLogger::Get().LogError(TEXT("No focused graph in Blueprint Editor"));
+        return;
+    }
+
+    // Collect the selection and everything it takes data from
+    TArray<UK2Node*> CollectedNodes;
+    if (!FN2CNodeCollector::Get().CollectSelectedNodes(FocusedGraph, Editor->GetSelectedNodes(), CollectedNodes))
+    {
+        FN2CLogger::Get().LogError(TEXT("Failed to collect selected nodes"));
+        return;
+    }
 
-        // Generate N2CStruct from collected nodes
-        if (Translator.GenerateN2CStruct(CollectedNodes))
+    ActiveJob = MakeShared<FN2CTranslationJob>(
+        FText::Format(NSLOCTEXT("NodeToCode", "SelectionJobLabel", "selection in {0}"), FText::FromString(FocusedGraph->GetName())),
+        FOnN2CTranslationJobFinished::CreateLambda([this, GraphName = FocusedGraph->GetName()](bool bSuccess, FN2CTranslationSession& Session)
         {
-            FN2CLogger::Get().Log(TEXT("Node translation successful"), EN2CLogSeverity::Info);
+            if (bSuccess)
+            {
+                FN2CLogger::Get().Log(TEXT("Selection translation successful"), EN2CLogSeverity::Info, GraphName);
+                SubmitTranslation(UN2CLLMModule::Get(), Session.GetN2CBlueprint());
+            }
+            else
+            {
+                FN2CLogger::Get().LogError(TEXT("Failed to translate selected nodes"));
+            }
+        }));
+    ActiveJob->StartNodeTranslation(CollectedNodes);
+}
 
-            // Get the Blueprint structure
-            const FN2CBlueprint& Blueprint = FN2CNodeTranslator::Get().GetN2CBlueprint();
-            
-            // Validate the generated Blueprint
-            if (Blueprint.IsValid())
+void FN2CEditorIntegration::ExecuteTranslateBlueprintForEditor(TWeakPtr<FBlueprintEditor> InEditor)
+{
+    // Check if translation is already in progress
+    if (IsTranslationInProgress())
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Translation already in progress, please wait"));
+        return;
+    }
+
+    FN2CLogger::Get().Log(TEXT("ExecuteTranslateBlueprintForEditor called"), EN2CLogSeverity::Debug);
+
+    // Show the window as a tab
+    FGlobalTabmanager::Get()->TryInvokeTab(SN2CEditorWindow::TabId);
+
+    // Get the editor pointer
+    TSharedPtr<FBlueprintEditor> Editor = InEditor.Pin();
+    if (!Editor.IsValid())
+    {
+        FN2CLogger::Get().LogError(TEXT("Invalid Blueprint Editor pointer"));
+        return;
+    }
+
+    UBlueprint* BlueprintObj = Editor->GetBlueprintObj();
+    if (!BlueprintObj)
+    {
+        FN2CLogger::Get().LogError(TEXT("No Blueprint open in Blueprint Editor"));
+        return;
+    }
+
+    // A translation prepared in the background goes straight to the LLM
+    const bool bClaimed = FN2CSpeculativeTranslation::Get().Claim(BlueprintObj, FOnN2CSpeculationClaimed::CreateLambda(
+        [this, WeakBlueprint = TWeakObjectPtr<UBlueprint>(BlueprintObj)](bool bReady, const FN2CBlueprint& Blueprint, const FString& JsonOutput)
+        {
+            UBlueprint* TranslatedBlueprint = WeakBlueprint.Get();
+            if (!bReady)
             {
-                FN2CLogger::Get().Log(TEXT("Node translation validation successful"), EN2CLogSeverity::Info);
+                // Edited before the background translation finished
+                if (TranslatedBlueprint)
+                {
+                    StartBlueprintTranslation(TranslatedBlueprint);
+                }
+                return;
+            }
 
-                // Serialize to JSON with pretty printing enabled                                                                                                                                             
-                FN2CSerializer::SetPrettyPrint(false);
-                FString JsonOutput = FN2CSerializer::ToJson(Blueprint);                                                                                                                                       
-                                                                                                                                                                                                           
-                // Log the JSON output                                                                                                                                                                        
-                if (!JsonOutput.IsEmpty())                                                                                                                                                                    
-                {                                                                                                                                                                                             
-                    FN2CLogger::Get().Log(TEXT("JSON Output:"), EN2CLogSeverity::Debug);                                                                                                                       
-                    FN2CLogger::Get().Log(JsonOutput, EN2CLogSeverity::Debug);
-                    
-                    if (LLMModule->Initialize())
+            UpdateBlueprintIndex(TranslatedBlueprint);
+            SubmitJson(UN2CLLMModule::Get(), Blueprint, JsonOutput);
+        }));
+
+    if (!bClaimed)
+    {
+        StartBlueprintTranslation(BlueprintObj);
+    }
+}
+
+void FN2CEditorIntegration::StartBlueprintTranslation(UBlueprint* BlueprintObj)
+{
+    // Translate every graph of the Blueprint into a single structure
+    ActiveJob = MakeShared<FN2CTranslationJob>(FText::FromString(BlueprintObj->GetName()),
+        FOnN2CTranslationJobFinished::CreateLambda([this, WeakBlueprint = TWeakObjectPtr<UBlueprint>(BlueprintObj), BlueprintName = BlueprintObj->GetName()](bool bSuccess, FN2CTranslationSession& Session)
+        {
+            if (!bSuccess)
+            {
+                FN2CLogger::Get().LogError(FString::Printf(TEXT("Failed to translate Blueprint: %s"), *BlueprintName));
+                return;
+            }
+
+            FN2CLogger::Get().Log(TEXT("Blueprint translation successful"), EN2CLogSeverity::Info, BlueprintName);
+
+            UpdateBlueprintIndex(WeakBlueprint.Get());
+            SubmitTranslation(UN2CLLMModule::Get(), Session.GetN2CBlueprint());
+        }));
+    ActiveJob->StartBlueprintTranslation(BlueprintObj);
+}
+
+void FN2CEditorIntegration::UpdateBlueprintIndex(UBlueprint* BlueprintObj)
+{
+    // The index reads graphs before any passes, so it translates the Blueprint again on its own
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    if (Settings && Settings->bMaintainBlueprintIndex && BlueprintObj)
+    {
+        FN2CBlueprintIndex::Get().QueueBlueprint(BlueprintObj);
+    }
+}
+
+bool FN2CEditorIntegration::IsTranslationInProgress() const
+{
+    const UN2CLLMModule* LLMModule = UN2CLLMModule::Get();
+    return (ActiveJob.IsValid() && ActiveJob->IsRunning())
+        || FN2CSpeculativeTranslation::Get().HasPendingClaim()
+        || (LLMModule && LLMModule->GetSystemStatus() == EN2CSystemStatus::Processing);
+}
+
+void FN2CEditorIntegration::SubmitTranslation(UN2CLLMModule* LLMModule, const FN2CBlueprint& Blueprint)
+{
+    // Validate the generated Blueprint
+    if (!Blueprint.IsValid())
+    {
+        FN2CLogger::Get().LogError(TEXT("Node translation validation failed"));
+        return;
+    }
+
+    FN2CLogger::Get().Log(TEXT("Node translation validation successful"), EN2CLogSeverity::Info);
+
+    // Serialize to condensed JSON
+    FN2CSerializer::SetPrettyPrint(false);
+    SubmitJson(LLMModule, Blueprint, FN2CSerializer::ToJson(Blueprint));
+}
+
+void FN2CEditorIntegration::SubmitJson(UN2CLLMModule* LLMModule, const FN2CBlueprint& Blueprint, const FString& JsonOutput)
+{
+    if (JsonOutput.IsEmpty())
+    {
+        FN2CLogger::Get().LogError(TEXT("JSON serialization failed"));
+        return;
+    }
+
+    // Log the JSON output
+    FN2CLogger::Get().Log(TEXT("JSON Output:"), EN2CLogSeverity::Debug);
+    FN2CLogger::Get().Log(JsonOutput, EN2CLogSeverity::Debug);
+
+    if (!LLMModule->Initialize())
+    {
+        FN2CLogger::Get().LogError(TEXT("Failed to initialize LLM Module"));
+        return;
+    }
+
+    // Send JSON to LLM service
+    LLMModule->ProcessN2CJson(JsonOutput, Blueprint, FOnLLMResponseReceived::CreateLambda(
+        [](const FString& Response)
+        {
+            FN2CLogger::Get().Log(FString::Printf(TEXT("LLM Response:\n\n%s"), *Response), EN2CLogSeverity::Debug);
+
+            // Create translation response struct
+            FN2CTranslationResponse TranslationResponse;
+
+            // Get active service's response parser
+            TScriptInterface<IN2CLLMService> ActiveService = UN2CLLMModule::Get()->GetActiveService();
+            if (ActiveService.GetInterface())
+            {
+                UN2CResponseParserBase* Parser = ActiveService->GetResponseParser();
+                if (Parser)
+                {
+                    if (Parser->ParseLLMResponse(Response, TranslationResponse))
                     {
-                        // Send JSON to LLM service                                                                                                                                                        
-                        LLMModule->ProcessN2CJson(JsonOutput, FOnLLMResponseReceived::CreateLambda(
-                            [](const FString& Response)                                                                                                                                                   
-                            {                                                                                                                                                                             
-                                FN2CLogger::Get().Log(FString::Printf(TEXT("LLM Response:\n\n%s"), *Response), EN2CLogSeverity::Debug);                                                                                                      
-                            
-                                // Create translation response struct
-                                FN2CTranslationResponse TranslationResponse;
-                            
-                                // Get active service's response parser
-                                TScriptInterface<IN2CLLMService> ActiveService = UN2CLLMModule::Get()->GetActiveService();
-                                if (ActiveService.GetInterface())
-                                {
-                                    UN2CResponseParserBase* Parser = ActiveService->GetResponseParser();
-                                    if (Parser)
-                                    {
-                                        if (Parser->ParseLLMResponse(Response, TranslationResponse))
-                                        {
-                                            // Log successful parsing
-                                            FN2CLogger::Get().Log(TEXT("Successfully parsed LLM response"), EN2CLogSeverity::Info);
-                                        }
-                                        else
-                                        {
-                                            FN2CLogger::Get().LogError(TEXT("Failed to parse LLM response"));
-                                        }
-                                    }
-                                    else
-                                    {
-                                        FN2CLogger::Get().LogError(TEXT("No response parser available"));
-                                    }
-                                }
-                                else
-                                {
-                                    FN2CLogger::Get().LogError(TEXT("No active LLM service"));
-                                }
-                            }));
+                        // Log successful parsing
+                        FN2CLogger::Get().Log(TEXT("Successfully parsed LLM response"), EN2CLogSeverity::Info);
                     }
                     else
                     {
-                        FN2CLogger::Get().LogError(TEXT("Failed to initialize LLM Module"));
+                        FN2CLogger::Get().LogError(TEXT("Failed to parse LLM response"));
                     }
                 }
                 else
                 {
-                    FN2CLogger::Get().LogError(TEXT("JSON serialization failed"));
+                    FN2CLogger::Get().LogError(TEXT("No response parser available"));
                 }
             }
             else
             {
-                FN2CLogger::Get().LogError(TEXT("Node translation validation failed"));
+                FN2CLogger::Get().LogError(TEXT("No active LLM service"));
             }
-        }
-        else
-        {
-            FN2CLogger::Get().LogError(TEXT("Failed to translate nodes"));
-        }
-    }
+        }));
 }
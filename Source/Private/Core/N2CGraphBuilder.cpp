@@ -0,0 +1,229 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CGraphBuilder.h"
+
+#include "Async/ParallelFor.h"
+
+void FN2CGraphBuilder::BuildGraphs(const TArray<FN2CGraphSnapshot>& Snapshots, TArray<FN2CGraph>& OutGraphs, bool bParallel)
+{
+    OutGraphs.Reset();
+    OutGraphs.SetNum(Snapshots.Num());
+
+    ParallelFor(Snapshots.Num(), [&Snapshots, &OutGraphs](int32 Index)
+    {
+        FN2CGraphBuilder Builder(Snapshots[Index]);
+        Builder.Build(OutGraphs[Index]);
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+FN2CGraphBuilder::FN2CGraphBuilder(const FN2CGraphSnapshot& InSnapshot)
+    : Snapshot(InSnapshot)
+{
+}
+
+void FN2CGraphBuilder::Build(FN2CGraph& OutGraph)
+{
+    if (Snapshot.CachedGraph.IsValid())
+    {
+        OutGraph = *Snapshot.CachedGraph;
+        return;
+    }
+
+    OutGraph.Name = Snapshot.Name;
+    OutGraph.GraphType = Snapshot.GraphType;
+
+    AddNodes(OutGraph);
+    ResolveKnots();
+    BuildFlows(OutGraph);
+}
+
+void FN2CGraphBuilder::AddNodes(FN2CGraph& OutGraph)
+{
+    GraphNodeIndices.Init(INDEX_NONE, Snapshot.Nodes.Num());
+    OutGraph.Nodes.Reserve(Snapshot.Nodes.Num());
+
+    int32 NumPins = 0;
+    for (const FN2CNodeSnapshot& NodeSnapshot : Snapshot.Nodes)
+    {
+        NumPins += NodeSnapshot.Pins.Num();
+    }
+    PinIndices.Reserve(NumPins);
+    PinNodeIndices.Reserve(NumPins);
+    Pins.Reserve(NumPins);
+
+    for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+    {
+        const FN2CNodeSnapshot& NodeSnapshot = Snapshot.Nodes[NodeIndex];
+
+        for (const FN2CPinSnapshot& Pin : NodeSnapshot.Pins)
+        {
+            PinIndices.Add(Pin.PinId, Pins.Num());
+            PinNodeIndices.Add(NodeIndex);
+            Pins.Add(&Pin);
+        }
+
+        // Knots are only needed for tracing and are not part of the graph
+        if (!NodeSnapshot.bIsKnot)
+        {
+            GraphNodeIndices[NodeIndex] = OutGraph.Nodes.Add(NodeSnapshot.Definition);
+        }
+    }
+}
+
+void FN2CGraphBuilder::BuildFlows(FN2CGraph& OutGraph) const
+{
+    // Several exec pins of a node can lead to the same node; the pair set keeps each edge once
+    TSet<uint64> ExecEdges;
+
+    for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+    {
+        const int32 GraphNodeIndex = GraphNodeIndices[NodeIndex];
+        if (GraphNodeIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const FN2CNodeSnapshot& NodeSnapshot = Snapshot.Nodes[NodeIndex];
+
+        for (const FN2CPinSnapshot& Pin : NodeSnapshot.Pins)
+        {
+            // Hidden pins take no part in flows
+            if (Pin.DefinitionIndex == INDEX_NONE)
+            {
+                continue;
+            }
+
+            // Execution flows are recorded from the output side
+            if (Pin.bIsExec)
+            {
+                if (Pin.bIsInput)
+                {
+                    continue;
+                }
+
+                for (const FGuid& LinkedPinId : Pin.LinkedPinIds)
+                {
+                    const int32 Endpoint = FindEndpoint(LinkedPinId);
+                    if (Endpoint == INDEX_NONE)
+                    {
+                        continue;
+                    }
+
+                    const int32 TargetNodeIndex = GraphNodeIndices[PinNodeIndices[Endpoint]];
+                    bool bAlreadyAdded = false;
+                    ExecEdges.Add((static_cast<uint64>(GraphNodeIndex) << 32) | static_cast<uint32>(TargetNodeIndex), &bAlreadyAdded);
+                    if (!bAlreadyAdded)
+                    {
+                        OutGraph.Flows.Execution.Add(FN2CExecEdge(GraphNodeIndex, TargetNodeIndex));
+                    }
+                }
+                continue;
+            }
+
+            // Data flows are recorded from the input side, where every link is seen exactly once
+            if (!Pin.bIsInput)
+            {
+                continue;
+            }
+
+            const int32 TargetPinIndex = GetPinIndex(OutGraph.Nodes[GraphNodeIndex], Pin);
+            for (const FGuid& LinkedPinId : Pin.LinkedPinIds)
+            {
+                const int32 Endpoint = FindEndpoint(LinkedPinId);
+                if (Endpoint == INDEX_NONE || Pins[Endpoint]->bIsInput)
+                {
+                    continue;
+                }
+
+                const int32 SourceGraphIndex = GraphNodeIndices[PinNodeIndices[Endpoint]];
+                const int32 SourcePinIndex = GetPinIndex(OutGraph.Nodes[SourceGraphIndex], *Pins[Endpoint]);
+                if (SourcePinIndex == INDEX_NONE)
+                {
+                    continue;
+                }
+
+                OutGraph.Flows.Data.Add(FN2CDataEdge(SourceGraphIndex, SourcePinIndex, GraphNodeIndex, TargetPinIndex));
+            }
+        }
+    }
+}
+
+void FN2CGraphBuilder::ResolveKnots()
+{
+    // Sentinels for pins being walked and pins not yet visited
+    constexpr int32 InProgress = -2;
+    constexpr int32 Unresolved = -3;
+
+    ResolvedEndpoints.Init(Unresolved, Pins.Num());
+
+    TArray<int32, TInlineAllocator<32>> Chain;
+    for (int32 StartIndex = 0; StartIndex < Pins.Num(); ++StartIndex)
+    {
+        // Walk until reaching a real pin, an already resolved pin, a dead end or a cycle
+        int32 Result = INDEX_NONE;
+        int32 Current = StartIndex;
+        Chain.Reset();
+
+        while (true)
+        {
+            const int32 Resolved = ResolvedEndpoints[Current];
+            if (Resolved == InProgress)
+            {
+                Result = INDEX_NONE;  // Cycle in knot chain
+                break;
+            }
+            if (Resolved != Unresolved)
+            {
+                Result = Resolved;
+                break;
+            }
+
+            const FN2CNodeSnapshot& Node = Snapshot.Nodes[PinNodeIndices[Current]];
+            if (!Node.bIsKnot)
+            {
+                ResolvedEndpoints[Current] = Current;
+                Result = Current;
+                break;
+            }
+
+            ResolvedEndpoints[Current] = InProgress;
+            Chain.Add(Current);
+
+            // Knots have a single input (0) and output (1); continue on the opposite side
+            const int32 OppositePinIndex = Pins[Current]->bIsInput ? 1 : 0;
+            if (!Node.Pins.IsValidIndex(OppositePinIndex) || Node.Pins[OppositePinIndex].LinkedPinIds.Num() == 0)
+            {
+                break;  // Dead end
+            }
+
+            const int32* Next = PinIndices.Find(Node.Pins[OppositePinIndex].LinkedPinIds[0]);
+            if (!Next)
+            {
+                break;  // Link leaves the snapshot
+            }
+            Current = *Next;
+        }
+
+        // Compress the walked chain onto its endpoint
+        for (const int32 ChainIndex : Chain)
+        {
+            ResolvedEndpoints[ChainIndex] = Result;
+        }
+    }
+}
+
+int32 FN2CGraphBuilder::FindEndpoint(const FGuid& LinkedPinId) const
+{
+    const int32* PinIndex = PinIndices.Find(LinkedPinId);
+    return PinIndex ? ResolvedEndpoints[*PinIndex] : INDEX_NONE;
+}
+
+int32 FN2CGraphBuilder::GetPinIndex(const FN2CNodeDefinition& NodeDef, const FN2CPinSnapshot& Pin)
+{
+    if (Pin.DefinitionIndex == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+
+    return Pin.bIsInput ? Pin.DefinitionIndex : NodeDef.InputPins.Num() + Pin.DefinitionIndex;
+}
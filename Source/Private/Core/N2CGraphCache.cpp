@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CGraphCache.h"
+
+#include "EdGraph/EdGraph.h"
+#include "UObject/Package.h"
+#include "UObject/PackageReload.h"
+
+FN2CGraphCache& FN2CGraphCache::Get()
+{
+    static FN2CGraphCache Instance;
+    return Instance;
+}
+
+void FN2CGraphCache::Initialize()
+{
+    if (!ObjectModifiedHandle.IsValid())
+    {
+        ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FN2CGraphCache::HandleObjectModified);
+    }
+
+    if (!PackageReloadedHandle.IsValid())
+    {
+        PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FN2CGraphCache::HandlePackageReloaded);
+    }
+}
+
+void FN2CGraphCache::Shutdown()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+        ObjectModifiedHandle.Reset();
+    }
+
+    if (PackageReloadedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+        PackageReloadedHandle.Reset();
+    }
+
+    Clear();
+}
+
+const FN2CGraphCache::FEntry* FN2CGraphCache::Find(const UEdGraph* Graph) const
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+
+    const FEntry* Entry = Entries.Find(Graph->GetPathName());
+    if (!Entry || Entry->Graph.Get() != Graph || Entry->PackageStamp != GetPackageStamp(Graph))
+    {
+        return nullptr;
+    }
+
+    return Entry;
+}
+
+void FN2CGraphCache::Store(const UEdGraph* Graph, FEntry&& Entry)
+{
+    // The package may have been edited while the graph was being translated
+    if (!Graph || !Entry.BuiltGraph.IsValid() || Entry.PackageStamp != GetPackageStamp(Graph))
+    {
+        return;
+    }
+
+    Entry.Graph = Graph;
+    Entries.Add(Graph->GetPathName(), MoveTemp(Entry));
+}
+
+uint32 FN2CGraphCache::GetPackageStamp(const UEdGraph* Graph) const
+{
+    // Packages that were never modified share stamp 0
+    const UPackage* Package = Graph ? Graph->GetPackage() : nullptr;
+    const uint32* Stamp = Package ? PackageStamps.Find(Package->GetFName()) : nullptr;
+    return Stamp ? *Stamp : 0;
+}
+
+void FN2CGraphCache::Clear()
+{
+    Entries.Empty();
+}
+
+void FN2CGraphCache::BumpPackage(const UPackage* Package)
+{
+    if (Package)
+    {
+        PackageStamps.FindOrAdd(Package->GetFName()) = ++LastStamp;
+    }
+}
+
+void FN2CGraphCache::HandleObjectModified(UObject* Object)
+{
+    // Graph edits call Modify on the node, pin owner or graph, all of which live in the graph's package
+    if (Object)
+    {
+        BumpPackage(Object->GetPackage());
+    }
+}
+
+void FN2CGraphCache::HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+    if (Phase == EPackageReloadPhase::PrePackageFixup && Event)
+    {
+        BumpPackage(Event->GetOldPackage());
+    }
+}
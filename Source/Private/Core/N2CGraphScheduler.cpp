@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CGraphScheduler.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_Knot.h"
+
+namespace N2CGraphScheduler
+{
+    /** Approximate serialized size of a node without its pins, in tokens */
+    constexpr int32 TokensPerNode = 50;
+
+    /** Approximate serialized size of a pin, in tokens */
+    constexpr int32 TokensPerPin = 40;
+
+    /** Shallower graphs first, then cheaper graphs so more of them fit the budget */
+    struct FPriority
+    {
+        bool operator()(const FN2CScheduledGraph& A, const FN2CScheduledGraph& B) const
+        {
+            return A.Depth != B.Depth ? A.Depth < B.Depth : A.EstimatedTokens < B.EstimatedTokens;
+        }
+    };
+}
+
+void FN2CGraphScheduler::Reset(int32 InMaxDepth, int32 InTokenBudget)
+{
+    Visited.Reset();
+    Queue.Reset();
+    OverBudgetGraphs.Reset();
+    MaxDepth = InMaxDepth;
+    TokenBudget = FMath::Max(InTokenBudget, 0);
+    UsedTokens = 0;
+    NumEnqueued = 0;
+    DeepestLevel = 0;
+    TotalEstimatedTokens = 0;
+}
+
+bool FN2CGraphScheduler::MarkVisited(const UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return false;
+    }
+
+    bool bAlreadyVisited = false;
+    Visited.Add(Graph, &bAlreadyVisited);
+    return !bAlreadyVisited;
+}
+
+bool FN2CGraphScheduler::Enqueue(UEdGraph* Graph, int32 ParentDepth)
+{
+    if (!Graph || ExceedsMaxDepth(ParentDepth) || !MarkVisited(Graph))
+    {
+        return false;
+    }
+
+    // Levels are handed out in order, so the first time a graph is seen is its shallowest depth
+    FN2CScheduledGraph Scheduled;
+    Scheduled.Graph = Graph;
+    Scheduled.Depth = ParentDepth + 1;
+    Scheduled.EstimatedTokens = EstimateTokens(Graph);
+    Queue.HeapPush(Scheduled, N2CGraphScheduler::FPriority());
+
+    ++NumEnqueued;
+    DeepestLevel = FMath::Max(DeepestLevel, Scheduled.Depth);
+    TotalEstimatedTokens += Scheduled.EstimatedTokens;
+    return true;
+}
+
+bool FN2CGraphScheduler::Dequeue(FN2CScheduledGraph& OutGraph)
+{
+    while (Queue.Num() > 0)
+    {
+        FN2CScheduledGraph Scheduled;
+        Queue.HeapPop(Scheduled, N2CGraphScheduler::FPriority());
+
+        if (TokenBudget > 0 && UsedTokens + Scheduled.EstimatedTokens > TokenBudget)
+        {
+            OverBudgetGraphs.Add(Scheduled);
+            continue;
+        }
+
+        UsedTokens += Scheduled.EstimatedTokens;
+        OutGraph = Scheduled;
+        return true;
+    }
+
+    return false;
+}
+
+int32 FN2CGraphScheduler::EstimateTokens(const UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return 0;
+    }
+
+    int32 Tokens = 0;
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        Tokens += EstimateTokens(Node);
+    }
+    return Tokens;
+}
+
+int32 FN2CGraphScheduler::EstimateTokens(const UEdGraphNode* Node)
+{
+    // Knots are not serialized
+    if (!Node || Node->IsA<UK2Node_Knot>())
+    {
+        return 0;
+    }
+
+    int32 NumVisiblePins = 0;
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin && !Pin->bHidden)
+        {
+            ++NumVisiblePins;
+        }
+    }
+    return EstimateNodeTokens(NumVisiblePins);
+}
+
+int32 FN2CGraphScheduler::EstimateNodeTokens(int32 NumVisiblePins)
+{
+    return N2CGraphScheduler::TokensPerNode + NumVisiblePins * N2CGraphScheduler::TokensPerPin;
+}
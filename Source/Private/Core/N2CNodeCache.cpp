@@ -0,0 +1,222 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CNodeCache.h"
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Utils/N2CLogger.h"
+
+FN2CNodeCache& FN2CNodeCache::Get()
+{
+    static FN2CNodeCache Instance;
+    return Instance;
+}
+
+void FN2CNodeCache::Initialize()
+{
+    if (!ObjectModifiedHandle.IsValid())
+    {
+        ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FN2CNodeCache::HandleObjectModified);
+    }
+}
+
+void FN2CNodeCache::Shutdown()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+        ObjectModifiedHandle.Reset();
+    }
+
+    Clear();
+}
+
+const FN2CNodeSnapshot* FN2CNodeCache::Find(const UEdGraphNode* Node) const
+{
+    if (!Node)
+    {
+        return nullptr;
+    }
+
+    const FCacheEntry* Entry = Entries.Find(Node->NodeGuid);
+    if (!Entry || Entry->Node.Get() != Node)
+    {
+        return nullptr;
+    }
+
+    return &Entry->Snapshot;
+}
+
+void FN2CNodeCache::Store(const UEdGraphNode* Node, const FN2CNodeSnapshot& Snapshot)
+{
+    if (!Node)
+    {
+        return;
+    }
+
+    FCacheEntry& Entry = Entries.FindOrAdd(Node->NodeGuid);
+    Entry.Node = Node;
+    Entry.Graph = Node->GetGraph();
+    Entry.Blueprint = FBlueprintEditorUtils::FindBlueprintForNode(Node);
+    Entry.Snapshot = Snapshot;
+
+    Entry.LinkedNodeGuids.Reset();
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin)
+        {
+            continue;
+        }
+
+        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+        {
+            if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+            {
+                Entry.LinkedNodeGuids.AddUnique(LinkedPin->GetOwningNodeUnchecked()->NodeGuid);
+            }
+        }
+    }
+
+    WatchNode(Node);
+}
+
+void FN2CNodeCache::InvalidateNode(const UEdGraphNode* Node)
+{
+    if (!Node)
+    {
+        return;
+    }
+
+    // Pin connection state of neighbours depends on this node, so drop them as well.
+    // Both the links seen when caching and the current links are used to catch removed links.
+    TArray<FGuid, TInlineAllocator<16>> GuidsToRemove;
+    GuidsToRemove.Add(Node->NodeGuid);
+
+    if (const FCacheEntry* Entry = Entries.Find(Node->NodeGuid))
+    {
+        GuidsToRemove.Append(Entry->LinkedNodeGuids);
+    }
+
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin)
+        {
+            continue;
+        }
+
+        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+        {
+            if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+            {
+                GuidsToRemove.Add(LinkedPin->GetOwningNodeUnchecked()->NodeGuid);
+            }
+        }
+    }
+
+    for (const FGuid& Guid : GuidsToRemove)
+    {
+        Entries.Remove(Guid);
+    }
+}
+
+void FN2CNodeCache::InvalidateGraph(const UEdGraph* Graph)
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        const UEdGraph* EntryGraph = It.Value().Graph.Get();
+        if (!EntryGraph || EntryGraph == Graph)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FN2CNodeCache::InvalidateBlueprint(const UBlueprint* Blueprint)
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        const UBlueprint* EntryBlueprint = It.Value().Blueprint.Get();
+        if (!EntryBlueprint || EntryBlueprint == Blueprint)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FN2CNodeCache::Clear()
+{
+    for (const TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& Pair : WatchedGraphs)
+    {
+        if (UEdGraph* Graph = Pair.Key.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(Pair.Value);
+        }
+    }
+    WatchedGraphs.Empty();
+
+    for (const TPair<TWeakObjectPtr<UBlueprint>, FDelegateHandle>& Pair : WatchedBlueprints)
+    {
+        if (UBlueprint* Blueprint = Pair.Key.Get())
+        {
+            Blueprint->OnCompiled().Remove(Pair.Value);
+        }
+    }
+    WatchedBlueprints.Empty();
+
+    Entries.Empty();
+}
+
+void FN2CNodeCache::WatchNode(const UEdGraphNode* Node)
+{
+    UEdGraph* Graph = Node->GetGraph();
+    if (Graph && !WatchedGraphs.Contains(Graph))
+    {
+        FDelegateHandle Handle = Graph->AddOnGraphChangedHandler(
+            FOnGraphChanged::FDelegate::CreateRaw(this, &FN2CNodeCache::HandleGraphChanged));
+        WatchedGraphs.Add(Graph, Handle);
+    }
+
+    UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForNode(Node);
+    if (Blueprint && !WatchedBlueprints.Contains(Blueprint))
+    {
+        FDelegateHandle Handle = Blueprint->OnCompiled().AddRaw(this, &FN2CNodeCache::HandleBlueprintCompiled);
+        WatchedBlueprints.Add(Blueprint, Handle);
+    }
+}
+
+void FN2CNodeCache::HandleGraphChanged(const FEdGraphEditAction& Action)
+{
+    // Notifications without specific nodes can mean anything changed
+    if (Action.Nodes.Num() == 0)
+    {
+        InvalidateGraph(Action.Graph);
+        FN2CLogger::Get().Log(FString::Printf(TEXT("Node cache: invalidated graph %s"),
+            Action.Graph ? *Action.Graph->GetName() : TEXT("<null>")), EN2CLogSeverity::Debug);
+        return;
+    }
+
+    for (const UEdGraphNode* Node : Action.Nodes)
+    {
+        InvalidateNode(Node);
+    }
+}
+
+void FN2CNodeCache::HandleBlueprintCompiled(UBlueprint* Blueprint)
+{
+    // Compilation can reconstruct nodes and change pin types
+    InvalidateBlueprint(Blueprint);
+    FN2CLogger::Get().Log(FString::Printf(TEXT("Node cache: invalidated Blueprint %s after compile"),
+        Blueprint ? *Blueprint->GetName() : TEXT("<null>")), EN2CLogSeverity::Debug);
+}
+
+void FN2CNodeCache::HandleObjectModified(UObject* Object)
+{
+    // Pin default value edits call Modify on the node without notifying the graph
+    const UEdGraphNode* Node = Cast<UEdGraphNode>(Object);
+    if (Node && Entries.Contains(Node->NodeGuid))
+    {
+        InvalidateNode(Node);
+    }
+}
@@ -1,6 +1,8 @@
 // Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
 
 #include "Core/N2CNodeCollector.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Knot.h"
 #include "Utils/N2CLogger.h"
 
 FN2CNodeCollector& FN2CNodeCollector::Get()
@@ -48,6 +50,83 @@ bool FN2CNodeCollector::CollectNodesFromGraph(UEdGraph* Graph, TArray<UK2Node*>&
     return true;
 }
 
+bool FN2CNodeCollector::CollectSelectedNodes(UEdGraph* Graph, const FGraphPanelSelectionSet& SelectedNodes, TArray<UK2Node*>& OutNodes)
+{
+    if (!Graph)
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Invalid graph provided to CollectSelectedNodes"));
+        return false;
+    }
+
+    // Seed the closure with the selected K2 nodes of this graph
+    TSet<const UEdGraphNode*> Closure;
+    TArray<const UEdGraphNode*> Stack;
+    for (UObject* Object : SelectedNodes)
+    {
+        const UK2Node* K2Node = Cast<UK2Node>(Object);
+        if (K2Node && K2Node->GetGraph() == Graph)
+        {
+            Closure.Add(K2Node);
+            Stack.Add(K2Node);
+        }
+    }
+
+    const int32 NumSelected = Closure.Num();
+    if (NumSelected == 0)
+    {
+        FN2CLogger::Get().LogWarning(TEXT("No nodes selected in the focused graph"));
+        return false;
+    }
+
+    // Walk data inputs back to their producers; reroute nodes are passed through
+    while (Stack.Num() > 0)
+    {
+        const UEdGraphNode* Node = Stack.Pop();
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            {
+                continue;
+            }
+
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const UEdGraphNode* Producer = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+                if (!Producer || !Producer->IsA<UK2Node>())
+                {
+                    continue;
+                }
+
+                bool bAlreadyCollected = false;
+                Closure.Add(Producer, &bAlreadyCollected);
+                if (!bAlreadyCollected)
+                {
+                    Stack.Add(Producer);
+                }
+            }
+        }
+    }
+
+    // Keep graph order so node IDs match a full translation of the same graph
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        UK2Node* K2Node = Cast<UK2Node>(Node);
+        if (K2Node && (Closure.Contains(K2Node) || K2Node->IsA<UK2Node_Knot>()))
+        {
+            OutNodes.Add(K2Node);
+        }
+    }
+
+    FN2CLogger::Get().Log(TEXT("Selection collection complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("Graph: %s, %d selected nodes, %d nodes with data dependencies, %d nodes in graph"),
+            *Graph->GetName(),
+            NumSelected,
+            Closure.Num(),
+            Graph->Nodes.Num()));
+
+    return true;
+}
+
 bool FN2CNodeCollector::CollectPinsFromNode(UK2Node* Node, TArray<UEdGraphPin*>& OutInputPins, TArray<UEdGraphPin*>& OutOutputPins)
 {
     if (!Node)
@@ -2,9 +2,22 @@
 
 #include "Core/N2CNodeTranslator.h"
 
+#include "Core/N2CGraphBuilder.h"
+#include "Core/N2CGraphCache.h"
+#include "Core/N2CNodeCache.h"
+#include "Core/N2CSerializer.h"
 #include "Core/N2CSettings.h"
+#include "Core/N2CTypeCache.h"
+#include "Utils/N2CGraphHasher.h"
+#include "Utils/N2CGraphPartitioner.h"
 #include "Utils/N2CLogger.h"
 #include "Utils/N2CNodeTypeRegistry.h"
+#include "Utils/Passes/N2CCanonicalOrderPass.h"
+#include "Utils/Passes/N2CDeadNodePass.h"
+#include "Utils/Passes/N2CDefaultValuePass.h"
+#include "Utils/Passes/N2CExecPinPass.h"
+#include "Utils/Passes/N2CExpressionFoldPass.h"
+#include "Utils/Passes/N2CSelfPinPass.h"
 #include "Utils/Validators/N2CBlueprintValidator.h"
 #include "UObject/UnrealType.h"
 #include "UObject/UObjectBase.h"
@@ -17,14 +30,20 @@ FN2CNodeTranslator& FN2CNodeTranslator::Get()
     return Instance;
 }
 
-bool FN2CNodeTranslator::GenerateN2CStruct(const TArray<UK2Node*>& CollectedNodes)
+bool FN2CNodeTranslator::GenerateN2CStruct(FN2CTranslationSession& InSession, const TArray<UK2Node*>& CollectedNodes)
 {
-    // Clear any existing data
-    N2CBlueprint = FN2CBlueprint();
-    NodeIDMap.Empty();
-    PinIDMap.Empty();
-    ProcessedStructPaths.Empty();  // Clear processed structs set
-    ProcessedEnumPaths.Empty();    // Clear processed enums set
+    return BeginNodeTranslation(InSession, CollectedNodes) && FinishTranslation(InSession);
+}
+
+bool FN2CNodeTranslator::GenerateN2CStructForBlueprint(FN2CTranslationSession& InSession, UBlueprint* Blueprint)
+{
+    return BeginBlueprintTranslation(InSession, Blueprint) && FinishTranslation(InSession);
+}
+
+bool FN2CNodeTranslator::BeginNodeTranslation(FN2CTranslationSession& InSession, const TArray<UK2Node*>& CollectedNodes)
+{
+    TGuardValue<FN2CTranslationSession*> SessionScope(Session, &InSession);
+    BeginTranslation();
 
     if (CollectedNodes.Num() == 0)
     {
@@ -34,122 +53,373 @@ bool FN2CNodeTranslator::GenerateN2CStruct(const TArray<UK2Node*>& CollectedNode
 
     FN2CLogger::Get().Log(TEXT("Starting node translation"), EN2CLogSeverity::Info);
 
-    // Get Blueprint metadata from first node (all nodes are from the same graph)                                                                                                                                                             
-    if (UK2Node* FirstNode = CollectedNodes[0])                                                                                                                                                                                        
+    // Get Blueprint metadata from first node (all nodes are from the same graph)
+    if (UK2Node* FirstNode = CollectedNodes[0])
     {
-        if (UBlueprint* Blueprint = FirstNode->GetBlueprint())
-        {
-            // Set Blueprint name
-            N2CBlueprint.Metadata.Name = Blueprint->GetName();
-            
-            // Set Blueprint class
-            if (UClass* BPClass = FirstNode->GetBlueprintClassFromNode())
-            {
-                N2CBlueprint.Metadata.BlueprintClass = GetCleanClassName(BPClass->GetName());
-            }
-            
-            // Determine Blueprint type
-            switch (Blueprint->BlueprintType)
-            {
-                case BPTYPE_Const:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Const;
-                    break;
-                case BPTYPE_MacroLibrary:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::MacroLibrary;
-                    break;
-                case BPTYPE_Interface:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Interface;
-                    break;
-                case BPTYPE_LevelScript:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::LevelScript;
-                    break;
-                case BPTYPE_FunctionLibrary:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::FunctionLibrary;
-                    break;
-                default:
-                    N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Normal;
-                    break;
-            }
-
-            // Log Blueprint info
-            FString Context = FString::Printf(TEXT("Blueprint: %s, Type: %s, Class: %s"),
-                *N2CBlueprint.Metadata.Name,
-                *StaticEnum<EN2CBlueprintType>()->GetNameStringByValue(static_cast<int64>(N2CBlueprint.Metadata.BlueprintType)),
-                *N2CBlueprint.Metadata.BlueprintClass);
-            FN2CLogger::Get().Log(TEXT("Blueprint metadata collected"), EN2CLogSeverity::Info, Context);
-        }
+        CollectBlueprintMetadata(FirstNode->GetBlueprint(), FirstNode->GetBlueprintClassFromNode());
     }
     
-    // Create initial graph for the nodes
-    FN2CGraph MainGraph;
+    // Phase 1: snapshot the main graph and every discovered graph on the game thread
+    Session->SnapshotStartTime = FPlatformTime::Seconds();
+
+    // The main graph is always translated, even if it ends up empty
+    FN2CTranslationSession::FPendingGraph& MainGraph = Session->PendingGraphs.AddDefaulted_GetRef();
+    MainGraph.bKeepIfEmpty = true;
     
     // Get graph info from first node
-    if (CollectedNodes.Num() > 0 && CollectedNodes[0])
+    if (CollectedNodes[0])
     {
         if (UEdGraph* Graph = CollectedNodes[0]->GetGraph())
         {
-            MainGraph.Name = Graph->GetName();
-            MainGraph.GraphType = DetermineGraphType(Graph);
+            MainGraph.Snapshot.Name = Graph->GetName();
+            MainGraph.Snapshot.GraphType = DetermineGraphType(Graph);
+            Session->GraphScheduler.MarkVisited(Graph);
+            Session->AddReadPackage(Graph);
             
             FString Context = FString::Printf(TEXT("Created graph: %s of type %s"),
-                *MainGraph.Name,
-                *StaticEnum<EN2CGraphType>()->GetNameStringByValue(static_cast<int64>(MainGraph.GraphType)));
+                *MainGraph.Snapshot.Name,
+                *StaticEnum<EN2CGraphType>()->GetNameStringByValue(static_cast<int64>(MainGraph.Snapshot.GraphType)));
             FN2CLogger::Get().Log(TEXT("Graph info"), EN2CLogSeverity::Debug, Context);
         }
     }
-    
-    CurrentGraph = &MainGraph;
 
-    // Process each node
+    MainGraph.Nodes = Session->AllocateNodeList(CollectedNodes.Num());
     for (UK2Node* Node : CollectedNodes)
     {
-        if (!Node)
+        MainGraph.Nodes[MainGraph.NumNodes++] = Node;
+
+        // Only the collected nodes count against the budget, which may be a selection of the graph
+        Session->GraphScheduler.ConsumeTokens(FN2CGraphScheduler::EstimateTokens(Node));
+    }
+    Session->NumNodesQueued += CollectedNodes.Num();
+
+    return true;
+}
+
+bool FN2CNodeTranslator::BeginBlueprintTranslation(FN2CTranslationSession& InSession, UBlueprint* Blueprint)
+{
+    TGuardValue<FN2CTranslationSession*> SessionScope(Session, &InSession);
+    BeginTranslation();
+
+    if (!Blueprint)
+    {
+        FN2CLogger::Get().LogWarning(TEXT("No Blueprint provided to translate"));
+        return false;
+    }
+
+    FN2CLogger::Get().Log(TEXT("Starting Blueprint translation"), EN2CLogSeverity::Info, Blueprint->GetName());
+
+    CollectBlueprintMetadata(Blueprint, Blueprint->GeneratedClass);
+
+    // Phase 1: snapshot every graph owned by the Blueprint on the game thread
+    Session->SnapshotStartTime = FPlatformTime::Seconds();
+
+    TArray<UEdGraph*> BlueprintGraphs;
+    BlueprintGraphs.Append(Blueprint->UbergraphPages);
+    BlueprintGraphs.Append(Blueprint->FunctionGraphs);
+    BlueprintGraphs.Append(Blueprint->MacroGraphs);
+    BlueprintGraphs.Append(Blueprint->DelegateSignatureGraphs);
+
+    // Mark every owned graph first so references between them are not scheduled as nested graphs
+    for (const UEdGraph* Graph : BlueprintGraphs)
+    {
+        Session->GraphScheduler.MarkVisited(Graph);
+        Session->GraphScheduler.ConsumeTokens(FN2CGraphScheduler::EstimateTokens(Graph));
+    }
+
+    for (UEdGraph* Graph : BlueprintGraphs)
+    {
+        if (Graph)
         {
-            FN2CLogger::Get().LogWarning(TEXT("Null node encountered during translation"));
+            QueueGraphSnapshot(Graph, 0);
+        }
+    }
+
+    return true;
+}
+
+bool FN2CNodeTranslator::StepSnapshots(FN2CTranslationSession& InSession, double TimeBudgetSeconds)
+{
+    TGuardValue<FN2CTranslationSession*> SessionScope(Session, &InSession);
+
+    // Checking the clock per node would cost more than snapshotting most nodes
+    constexpr int32 NodesPerTimeCheck = 16;
+
+    const double EndTime = FPlatformTime::Seconds() + TimeBudgetSeconds;
+    int32 NodesThisStep = 0;
+
+    while (true)
+    {
+        // Owned graphs come first, then discovered graphs level by level; graphs they reference are queued one level deeper
+        if (!Session->PendingGraphs.IsValidIndex(Session->NextPendingGraph))
+        {
+            FN2CScheduledGraph Scheduled;
+            if (!Session->GraphScheduler.Dequeue(Scheduled))
+            {
+                break;
+            }
+            QueueGraphSnapshot(Scheduled.Graph, Scheduled.Depth);
             continue;
         }
 
-        FN2CNodeDefinition NodeDef;
-        if (ProcessNode(Node, NodeDef))
+        FN2CTranslationSession::FPendingGraph& Pending = Session->PendingGraphs[Session->NextPendingGraph];
+        Session->CurrentDepth = Pending.Depth;
+
+        while (Pending.NextNode < Pending.NumNodes)
+        {
+            // The graph may have been edited between steps
+            UK2Node* Node = Pending.Nodes[Pending.NextNode++].Get();
+            ++Session->NumNodesSnapshotted;
+
+            if (!Node)
+            {
+                FN2CLogger::Get().LogWarning(TEXT("Null node encountered during translation"));
+                continue;
+            }
+
+            FN2CNodeSnapshot NodeSnapshot;
+            if (SnapshotNode(Node, NodeSnapshot))
+            {
+                Pending.Snapshot.Nodes.Add(MoveTemp(NodeSnapshot));
+            }
+
+            if (++NodesThisStep % NodesPerTimeCheck == 0 && FPlatformTime::Seconds() >= EndTime)
+            {
+                return false;
+            }
+        }
+
+        // Keep discovered graphs only if they have translatable nodes
+        if (Pending.bKeepIfEmpty || Pending.Snapshot.NumTranslatedNodes() > 0)
         {
-            CurrentGraph->Nodes.Add(NodeDef);
+            FString Context = FString::Printf(TEXT("Snapshotted graph: %s with %d nodes"), 
+                *Pending.Snapshot.Name, 
+                Pending.Snapshot.Nodes.Num());
+            FN2CLogger::Get().Log(Context, EN2CLogSeverity::Debug);
+
+            // Dependency graphs are cached once built
+            if (Pending.CacheSource.IsValid())
+            {
+                FN2CTranslationSession::FGraphCacheCandidate& Candidate = Session->GraphCacheCandidates.AddDefaulted_GetRef();
+                Candidate.SnapshotIndex = Session->GraphSnapshots.Num();
+                Candidate.Graph = Pending.CacheSource;
+                Candidate.Entry = MoveTemp(Pending.CacheEntry);
+            }
+
+            Session->GraphSnapshots.Add(MoveTemp(Pending.Snapshot));
         }
+
+        ++Session->NextPendingGraph;
     }
 
-    // Add the main graph to the blueprint
-    N2CBlueprint.Graphs.Add(MainGraph);
+    Session->PendingGraphs.Empty();
+    Session->NextPendingGraph = 0;
+
+    LogSnapshotSummary();
+    return true;
+}
+
+TArray<FN2CGraphSnapshot> FN2CNodeTranslator::TakeGraphSnapshots(FN2CTranslationSession& InSession)
+{
+    TArray<FN2CGraphSnapshot> Snapshots = MoveTemp(InSession.GraphSnapshots);
+    InSession.GraphSnapshots.Reset();
+    return Snapshots;
+}
+
+void FN2CNodeTranslator::BeginTranslation()
+{
+    // Sessions start out empty; only the limits come from the settings
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    Session->GraphScheduler.Reset(
+        Settings && !Session->bRawGraphs ? Settings->TranslationDepth : 0,
+        Settings ? Settings->GetTranslationTokenBudget() : 0);
+}
 
-    // Process any additional graphs that were discovered
-    while (AdditionalGraphsToProcess.Num() > 0)
+void FN2CNodeTranslator::CollectBlueprintMetadata(UBlueprint* Blueprint, UClass* BlueprintClass)
+{
+    if (!Blueprint)
     {
-        FGraphProcessInfo GraphInfo = AdditionalGraphsToProcess.Pop();
-        if (GraphInfo.Graph)
-        {
-            // Set the depth to parent depth before processing
-            CurrentDepth = GraphInfo.ParentDepth;
-            ProcessGraph(GraphInfo.Graph, DetermineGraphType(GraphInfo.Graph));
-        }
+        return;
     }
 
-    FString Context = FString::Printf(TEXT("Translated %d nodes in %d graphs"), 
-        MainGraph.Nodes.Num(), 
-        N2CBlueprint.Graphs.Num());
-    FN2CLogger::Get().Log(TEXT("Node translation complete"), EN2CLogSeverity::Info, Context);
+    // Set Blueprint name
+    Session->N2CBlueprint.Metadata.Name = Blueprint->GetName();
+    
+    // Set Blueprint class
+    if (BlueprintClass)
+    {
+        Session->N2CBlueprint.Metadata.BlueprintClass = GetCleanClassName(BlueprintClass->GetName());
+    }
+    
+    // Determine Blueprint type
+    switch (Blueprint->BlueprintType)
+    {
+        case BPTYPE_Const:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Const;
+            break;
+        case BPTYPE_MacroLibrary:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::MacroLibrary;
+            break;
+        case BPTYPE_Interface:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Interface;
+            break;
+        case BPTYPE_LevelScript:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::LevelScript;
+            break;
+        case BPTYPE_FunctionLibrary:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::FunctionLibrary;
+            break;
+        default:
+            Session->N2CBlueprint.Metadata.BlueprintType = EN2CBlueprintType::Normal;
+            break;
+    }
+
+    // Log Blueprint info
+    FString Context = FString::Printf(TEXT("Blueprint: %s, Type: %s, Class: %s"),
+        *Session->N2CBlueprint.Metadata.Name,
+        *StaticEnum<EN2CBlueprintType>()->GetNameStringByValue(static_cast<int64>(Session->N2CBlueprint.Metadata.BlueprintType)),
+        *Session->N2CBlueprint.Metadata.BlueprintClass);
+    FN2CLogger::Get().Log(TEXT("Blueprint metadata collected"), EN2CLogSeverity::Info, Context);
+}
+
+bool FN2CNodeTranslator::FinishTranslation(FN2CTranslationSession& InSession)
+{
+    StepSnapshots(InSession, TNumericLimits<double>::Max());
+
+    // Phase 2: build graphs from the snapshots
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bParallel = !Settings || Settings->bParallelGraphBuild;
 
-    return N2CBlueprint.Graphs.Num() > 0;
+    TArray<FN2CGraph> BuiltGraphs;
+    FN2CGraphBuilder::BuildGraphs(TakeGraphSnapshots(InSession), BuiltGraphs, bParallel);
+
+    return CompleteTranslation(InSession, BuiltGraphs);
 }
 
-FString FN2CNodeTranslator::GenerateNodeID()
+void FN2CNodeTranslator::LogSnapshotSummary()
 {
-    return FString::Printf(TEXT("N%d"), NodeIDMap.Num() + 1);
+    FN2CLogger::Get().Log(TEXT("Graph snapshots complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d graphs in %.2f ms, %d nodes extracted, %d reused from cache"),
+            Session->GraphSnapshots.Num(),
+            (FPlatformTime::Seconds() - Session->SnapshotStartTime) * 1000.0,
+            Session->NodeCacheMisses,
+            Session->NodeCacheHits));
+
+    if (Session->GraphCacheHits + Session->GraphCacheMisses > 0)
+    {
+        FN2CLogger::Get().Log(TEXT("Dependency graph cache"), EN2CLogSeverity::Info,
+            FString::Printf(TEXT("%d hits, %d misses, %d graphs cached"),
+                Session->GraphCacheHits, Session->GraphCacheMisses, FN2CGraphCache::Get().Num()));
+    }
+
+    if (Session->TypeCacheHits + Session->TypeCacheMisses > 0)
+    {
+        FN2CLogger::Get().Log(TEXT("Type extraction complete"), EN2CLogSeverity::Info,
+            FString::Printf(TEXT("%d types extracted, %d reused from cache"), Session->TypeCacheMisses, Session->TypeCacheHits));
+    }
+
+    if (Session->GraphScheduler.NumScheduled() > 0)
+    {
+        FN2CLogger::Get().Log(TEXT("Nested graph schedule"), EN2CLogSeverity::Info,
+            FString::Printf(TEXT("%d graphs over %d levels, estimated payload %lld tokens"),
+                Session->GraphScheduler.NumScheduled(),
+                Session->GraphScheduler.GetDeepestLevel(),
+                Session->GraphScheduler.GetUsedTokens()));
+    }
+
+    // Report nested graphs that were left out to stay within the token budget
+    if (Session->GraphScheduler.GetOverBudgetGraphs().Num() > 0)
+    {
+        FString SkippedList;
+        for (const FN2CScheduledGraph& Skipped : Session->GraphScheduler.GetOverBudgetGraphs())
+        {
+            const FString GraphName = Skipped.Graph ? Skipped.Graph->GetName() : TEXT("<null>");
+            Session->GraphsOverBudget.Add(GraphName);
+            SkippedList += FString::Printf(TEXT("\n  - %s (depth %d, ~%d tokens)"), *GraphName, Skipped.Depth, Skipped.EstimatedTokens);
+        }
+
+        FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Left out %d nested graphs to stay within the token budget of %d tokens:%s"),
+            Session->GraphsOverBudget.Num(), Session->GraphScheduler.GetTokenBudget(), *SkippedList));
+    }
 }
 
-FString FN2CNodeTranslator::GeneratePinID(int32 PinCount)
+bool FN2CNodeTranslator::CompleteTranslation(FN2CTranslationSession& InSession, TArray<FN2CGraph>& BuiltGraphs)
 {
-    return FString::Printf(TEXT("P%d"), PinCount + 1);
+    TGuardValue<FN2CTranslationSession*> SessionScope(Session, &InSession);
+
+    // Cache dependency graphs before the passes, which depend on the settings of each run
+    for (FN2CTranslationSession::FGraphCacheCandidate& Candidate : Session->GraphCacheCandidates)
+    {
+        const UEdGraph* Graph = Candidate.Graph.Get();
+        if (Graph && BuiltGraphs.IsValidIndex(Candidate.SnapshotIndex))
+        {
+            Candidate.Entry.BuiltGraph = MakeShared<FN2CGraph, ESPMode::ThreadSafe>(BuiltGraphs[Candidate.SnapshotIndex]);
+            FN2CGraphCache::Get().Store(Graph, MoveTemp(Candidate.Entry));
+        }
+    }
+    Session->GraphCacheCandidates.Empty();
+
+    // Raw graphs skip everything that changes their nodes or names
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bRawGraphs = Session->bRawGraphs;
+    if (!bRawGraphs)
+    {
+        RunGraphPasses(BuiltGraphs);
+    }
+
+    if (!bRawGraphs && Settings && Settings->bPartitionEventGraphs)
+    {
+        PartitionEventGraphs(BuiltGraphs);
+    }
+
+    // Merge the built graphs in discovery order
+
+    int32 TotalNodes = 0;
+    for (FN2CGraph& Graph : BuiltGraphs)
+    {
+        // Node details are only formatted when they will actually be logged
+        if (FN2CLogger::Get().IsSeverityEnabled(EN2CLogSeverity::Debug))
+        {
+            for (const FN2CNodeDefinition& NodeDef : Graph.Nodes)
+            {
+                LogNodeDetails(NodeDef);
+            }
+        }
+
+        // Validate all flow references
+        if (Graph.Nodes.Num() > 0 && !ValidateFlowReferences(Graph))
+        {
+            FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Flow validation issues found in graph: %s"), *Graph.Name));
+        }
+
+        FString Context = FString::Printf(TEXT("Processed graph: %s with %d nodes, %d execution flows, %d data flows"), 
+            *Graph.Name, 
+            Graph.Nodes.Num(),
+            Graph.Flows.Execution.Num(),
+            Graph.Flows.Data.Num());
+        FN2CLogger::Get().Log(TEXT("Graph processing complete"), EN2CLogSeverity::Info, Context);
+
+        TotalNodes += Graph.Nodes.Num();
+        Session->N2CBlueprint.Graphs.Add(MoveTemp(Graph));
+    }
+
+    // Content hashes of every node, graph and the Blueprint as a whole
+    FN2CGraphHasher::HashBlueprint(Session->N2CBlueprint);
+
+    if (!bRawGraphs && Settings && Settings->bDeduplicateGraphs)
+    {
+        DeduplicateGraphs(Session->N2CBlueprint);
+    }
+
+    FString Context = FString::Printf(TEXT("Translated %d nodes in %d graphs"), 
+        TotalNodes, 
+        Session->N2CBlueprint.Graphs.Num());
+    FN2CLogger::Get().Log(TEXT("Node translation complete"), EN2CLogSeverity::Info, Context);
+
+    return Session->N2CBlueprint.Graphs.Num() > 0;
 }
 
-bool FN2CNodeTranslator::InitializeNodeProcessing(UK2Node* Node, FN2CNodeDefinition& OutNodeDef)
+bool FN2CNodeTranslator::SnapshotNode(UK2Node* Node, FN2CNodeSnapshot& OutSnapshot)
 {
     if (!Node)
     {
@@ -157,55 +427,62 @@ bool FN2CNodeTranslator::InitializeNodeProcessing(UK2Node* Node, FN2CNodeDefinit
         return false;
     }
 
-    // Skip knot nodes entirely - they're just pass-through connections
+    OutSnapshot.NodeGuid = Node->NodeGuid;
+
+    // Knot nodes are just pass-through connections; keep only their links for tracing
     if (Node->IsA<UK2Node_Knot>())
     {
-        FN2CLogger::Get().Log(TEXT("Skipping knot node"), EN2CLogSeverity::Debug);
-        return false;
+        OutSnapshot.bIsKnot = true;
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            FN2CPinSnapshot& PinSnapshot = OutSnapshot.Pins.AddDefaulted_GetRef();
+            if (Pin)
+            {
+                PinSnapshot.PinId = Pin->PinId;
+                PinSnapshot.bIsInput = Pin->Direction == EGPD_Input;
+                SnapshotPinLinks(Pin, PinSnapshot);
+            }
+        }
+        return true;
     }
 
-    // Check if we already have an ID for this node
-    FString* ExistingID = NodeIDMap.Find(Node->NodeGuid);
-    if (ExistingID)
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bUseCache = Settings && Settings->bEnableNodeCache;
+
+    if (const FN2CNodeSnapshot* CachedSnapshot = bUseCache ? FN2CNodeCache::Get().Find(Node) : nullptr)
     {
-        OutNodeDef.ID = *ExistingID;
-        FString Context = FString::Printf(TEXT("Reusing existing node ID %s for node %s"), 
-            *OutNodeDef.ID,
-            *Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-        FN2CLogger::Get().Log(Context, EN2CLogSeverity::Debug);
+        OutSnapshot = *CachedSnapshot;
+        ++Session->NodeCacheHits;
     }
     else
     {
-        // Generate and map new node ID
-        FString NodeID = GenerateNodeID();
-        NodeIDMap.Add(Node->NodeGuid, NodeID);
-        OutNodeDef.ID = NodeID;
-        FString Context = FString::Printf(TEXT("Generated new node ID %s for node %s"), 
-            *NodeID,
-            *Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-        FN2CLogger::Get().Log(Context, EN2CLogSeverity::Debug);
+        ProcessNodeTypeAndProperties(Node, OutSnapshot.Definition);
+        ProcessNodePins(Node, OutSnapshot.Definition, OutSnapshot.Pins);
+        ++Session->NodeCacheMisses;
+
+        if (bUseCache)
+        {
+            FN2CNodeCache::Get().Store(Node, OutSnapshot);
+        }
     }
 
+    // Types and nested graphs are per-translation state, so always collect them
+    ProcessRelatedTypes(Node, OutSnapshot.Definition);
+    DiscoverNodeGraphs(Node);
+
     return true;
 }
 
-bool FN2CNodeTranslator::ProcessNode(UK2Node* Node, FN2CNodeDefinition& OutNodeDef)
+void FN2CNodeTranslator::SnapshotPinLinks(const UEdGraphPin* Pin, FN2CPinSnapshot& OutPinSnapshot) const
 {
-    if (!InitializeNodeProcessing(Node, OutNodeDef))
+    OutPinSnapshot.LinkedPinIds.Reserve(Pin->LinkedTo.Num());
+    for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
     {
-        return false;
+        if (LinkedPin)
+        {
+            OutPinSnapshot.LinkedPinIds.Add(LinkedPin->PinId);
+        }
     }
-
-    ProcessNodeTypeAndProperties(Node, OutNodeDef);
-
-    // Track pin connections for flows
-    TArray<UEdGraphPin*> ExecInputs;
-    TArray<UEdGraphPin*> ExecOutputs;
-    ProcessNodePins(Node, OutNodeDef, ExecInputs, ExecOutputs);
-    ProcessNodeFlows(Node, ExecInputs, ExecOutputs);
-    LogNodeDetails(OutNodeDef);
-
-    return true;
 }
 
 void FN2CNodeTranslator::AddGraphToProcess(UEdGraph* Graph)
@@ -215,13 +492,16 @@ void FN2CNodeTranslator::AddGraphToProcess(UEdGraph* Graph)
         return;
     }
 
-    // Check if we've already processed this graph
-    for (const FN2CGraph& ExistingGraph : N2CBlueprint.Graphs)
+    // Recorded before the visited check, which depends on what this translation saw first
+    if (FN2CGraphCache::FEntry* Recording = GetRecordingCacheEntry())
     {
-        if (ExistingGraph.Name == Graph->GetName())
-        {
-            return;
-        }
+        Recording->ReferencedGraphs.AddUnique(Graph);
+    }
+
+    // Graphs are keyed by object, so each one is considered once per translation
+    if (Session->GraphScheduler.IsVisited(Graph))
+    {
+        return;
     }
 
     // Check if this is a user-created graph
@@ -265,33 +545,24 @@ void FN2CNodeTranslator::AddGraphToProcess(UEdGraph* Graph)
     if (bIsUserCreated)
     {
         // Now check recursion depth limit since we know it's a user graph
-        const UN2CSettings* Settings = GetDefault<UN2CSettings>();
-        int32 NextDepth = CurrentDepth + 1;
-        if (Settings && NextDepth > Settings->TranslationDepth)
-        {
-            FString Context = FString::Printf(TEXT("Skipping graph '%s' - maximum translation depth reached (%d)"), 
-                *Graph->GetName(), Settings->TranslationDepth);
-            FN2CLogger::Get().Log(Context, EN2CLogSeverity::Warning);
-            return;
-        }
-
-        // Check if we already have this graph queued
-        bool bAlreadyQueued = false;
-        for (const FGraphProcessInfo& Info : AdditionalGraphsToProcess)
+        // Raw graphs never follow nested graphs, so there is nothing to warn about
+        if (Session->GraphScheduler.ExceedsMaxDepth(Session->CurrentDepth))
         {
-            if (Info.Graph == Graph)
+            if (!Session->bRawGraphs)
             {
-                bAlreadyQueued = true;
-                break;
+                const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+                FString Context = FString::Printf(TEXT("Skipping graph '%s' - maximum translation depth reached (%d)"), 
+                    *Graph->GetName(), Settings ? Settings->TranslationDepth : 0);
+                FN2CLogger::Get().Log(Context, EN2CLogSeverity::Warning);
             }
+            return;
         }
 
-        if (!bAlreadyQueued)
+        if (Session->GraphScheduler.Enqueue(Graph, Session->CurrentDepth))
         {
-            FString Context = FString::Printf(TEXT("Adding user-created graph to process: %s (Parent Depth: %d)"), 
-                *Graph->GetName(), CurrentDepth);
+            FString Context = FString::Printf(TEXT("Adding user-created graph to process: %s (Depth: %d)"), 
+                *Graph->GetName(), Session->CurrentDepth + 1);
             FN2CLogger::Get().Log(Context, EN2CLogSeverity::Debug);
-            AdditionalGraphsToProcess.Add(FGraphProcessInfo(Graph, CurrentDepth));
         }
     }
     else
@@ -302,54 +573,106 @@ void FN2CNodeTranslator::AddGraphToProcess(UEdGraph* Graph)
     }
 }
 
-bool FN2CNodeTranslator::ProcessGraph(UEdGraph* Graph, EN2CGraphType GraphType)
+void FN2CNodeTranslator::QueueGraphSnapshot(UEdGraph* Graph, int32 Depth)
 {
     if (!Graph)
     {
         FN2CLogger::Get().LogWarning(TEXT("Attempted to process null graph"));
-        return false;
+        return;
     }
 
-    // Create new graph structure
-    FN2CGraph NewGraph;
-    NewGraph.Name = Graph->GetName();
-    NewGraph.GraphType = GraphType;
-    CurrentGraph = &NewGraph;
+    Session->AddReadPackage(Graph);
 
-    // Collect and process nodes from this graph
-    TArray<UK2Node*> GraphNodes;
+    // Only nested dependency graphs are cached; graphs being translated directly are always re-read
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bUseCache = Depth > 0 && Settings && Settings->bEnableGraphCache;
+
+    if (bUseCache && SpliceCachedGraph(Graph, Depth))
+    {
+        return;
+    }
+
+    FN2CTranslationSession::FPendingGraph& Pending = Session->PendingGraphs.AddDefaulted_GetRef();
+    Pending.Snapshot.Name = Graph->GetName();
+    Pending.Snapshot.GraphType = DetermineGraphType(Graph);
+    Pending.Depth = Depth;
+
+    if (bUseCache)
+    {
+        ++Session->GraphCacheMisses;
+        Pending.CacheSource = Graph;
+        Pending.CacheEntry.PackageStamp = FN2CGraphCache::Get().GetPackageStamp(Graph);
+    }
+
+    // Only the node list is captured here; the nodes are snapshotted in later steps
+    Pending.Nodes = Session->AllocateNodeList(Graph->Nodes.Num());
     for (UEdGraphNode* Node : Graph->Nodes)
     {
         if (UK2Node* K2Node = Cast<UK2Node>(Node))
         {
-            FN2CNodeDefinition NodeDef;
-            if (ProcessNode(K2Node, NodeDef))
-            {
-                CurrentGraph->Nodes.Add(NodeDef);
-            }
+            Pending.Nodes[Pending.NumNodes++] = K2Node;
         }
     }
+    Session->NumNodesQueued += Pending.NumNodes;
+}
 
-    // Add the processed graph to the blueprint if it has nodes
-    if (CurrentGraph->Nodes.Num() > 0)
+bool FN2CNodeTranslator::SpliceCachedGraph(UEdGraph* Graph, int32 Depth)
+{
+    const FN2CGraphCache::FEntry* Entry = FN2CGraphCache::Get().Find(Graph);
+    if (!Entry)
     {
-        // Validate all flow references
-        if (!ValidateFlowReferences(NewGraph))
+        return false;
+    }
+
+    ++Session->GraphCacheHits;
+
+    // Copy the references out, following them can store new cache entries
+    TArray<UField*> ReferencedTypes;
+    for (const TWeakObjectPtr<UField>& Type : Entry->ReferencedTypes)
+    {
+        if (UField* ReferencedType = Type.Get())
         {
-            FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Flow validation issues found in graph: %s"), *NewGraph.Name));
+            ReferencedTypes.Add(ReferencedType);
         }
+    }
 
-        N2CBlueprint.Graphs.Add(NewGraph);
-        
-        FString Context = FString::Printf(TEXT("Processed graph: %s with %d nodes"), 
-            *NewGraph.Name, 
-            NewGraph.Nodes.Num());
-        FN2CLogger::Get().Log(TEXT("Graph processing complete"), EN2CLogSeverity::Info, Context);
-        
-        return true;
+    TArray<UEdGraph*> ReferencedGraphs;
+    for (const TWeakObjectPtr<UEdGraph>& ReferencedGraph : Entry->ReferencedGraphs)
+    {
+        if (UEdGraph* NestedGraph = ReferencedGraph.Get())
+        {
+            ReferencedGraphs.Add(NestedGraph);
+        }
+    }
+
+    // The builder copies the cached graph instead of building it from nodes
+    FN2CGraphSnapshot& Snapshot = Session->GraphSnapshots.AddDefaulted_GetRef();
+    Snapshot.Name = Graph->GetName();
+    Snapshot.GraphType = Entry->BuiltGraph->GraphType;
+    Snapshot.CachedGraph = Entry->BuiltGraph;
+
+    FN2CLogger::Get().Log(FString::Printf(TEXT("Graph %s reused from graph cache"), *Snapshot.Name), EN2CLogSeverity::Debug);
+
+    // Pull in what walking the nodes would have
+    Session->CurrentDepth = Depth;
+    AddReferencedTypes(ReferencedTypes);
+    for (UEdGraph* NestedGraph : ReferencedGraphs)
+    {
+        AddGraphToProcess(NestedGraph);
+    }
+
+    return true;
+}
+
+FN2CGraphCache::FEntry* FN2CNodeTranslator::GetRecordingCacheEntry() const
+{
+    if (!Session || !Session->PendingGraphs.IsValidIndex(Session->NextPendingGraph))
+    {
+        return nullptr;
     }
 
-    return false;
+    FN2CTranslationSession::FPendingGraph& Pending = Session->PendingGraphs[Session->NextPendingGraph];
+    return Pending.CacheSource.IsValid() ? &Pending.CacheEntry : nullptr;
 }
 
 EN2CGraphType FN2CNodeTranslator::DetermineGraphType(UEdGraph* Graph) const
@@ -475,60 +798,214 @@ EN2CPinType FN2CNodeTranslator::DeterminePinType(const UEdGraphPin* Pin) const
     return EN2CPinType::Wildcard;
 }
 
-UEdGraphPin* FN2CNodeTranslator::TraceConnectionThroughKnots(UEdGraphPin* StartPin) const
+bool FN2CNodeTranslator::ValidateFlowReferences(FN2CGraph& Graph)
+{
+    // Use the blueprint validator to validate the graph
+    FN2CBlueprintValidator Validator;
+    FString ErrorMessage;
+    return Validator.ValidateFlowReferences(Graph, ErrorMessage);
+}
+
+void FN2CNodeTranslator::RunGraphPasses(TArray<FN2CGraph>& Graphs)
 {
-    if (!StartPin)
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+
+    TArray<TUniquePtr<IN2CGraphPass>> Passes;
+    if (Settings && Settings->bPruneUnreachableNodes)
     {
-        return nullptr;
+        Passes.Add(MakeUnique<FN2CDeadNodePass>());
+    }
+    if (Settings && Settings->bFoldPureExpressions)
+    {
+        Passes.Add(MakeUnique<FN2CExpressionFoldPass>());
+    }
+    if (Settings && Settings->bStripZeroDefaultValues)
+    {
+        Passes.Add(MakeUnique<FN2CDefaultValuePass>());
+    }
+    if (Settings && Settings->bPruneSelfTargetPins)
+    {
+        Passes.Add(MakeUnique<FN2CSelfPinPass>());
+    }
+    if (Settings && Settings->bPruneUnlinkedExecPins)
+    {
+        Passes.Add(MakeUnique<FN2CExecPinPass>());
+    }
+    if (Settings && Settings->bCanonicalNodeOrder)
+    {
+        // Last, so it sees the final set of nodes and edges
+        Passes.Add(MakeUnique<FN2CCanonicalOrderPass>());
     }
 
-    UEdGraphPin* CurrentPin = StartPin;
-    TSet<UEdGraphNode*> VisitedNodes;  // Prevent infinite loops
+    if (Passes.Num() == 0)
+    {
+        return;
+    }
 
-    while (CurrentPin)
+    // Condensed JSON size of each graph, to measure what every pass saves. Serializing every
+    // graph after each changing pass costs more than most passes, so only debug logging pays for it
+    const bool bMeasureSizes = FN2CLogger::Get().IsSeverityEnabled(EN2CLogSeverity::Debug);
+    TArray<int32> GraphSizes;
+    if (bMeasureSizes)
     {
-        UEdGraphNode* OwningNode = CurrentPin->GetOwningNode();
-        if (!OwningNode)
+        GraphSizes.Reserve(Graphs.Num());
+        for (const FN2CGraph& Graph : Graphs)
         {
-            return nullptr;
+            GraphSizes.Add(FN2CSerializer::GetCondensedGraphSize(Graph));
         }
+    }
+
+    for (const TUniquePtr<IN2CGraphPass>& Pass : Passes)
+    {
+        const double PassStartTime = FPlatformTime::Seconds();
 
-        // If we've hit this node before, we have a loop
-        if (VisitedNodes.Contains(OwningNode))
+        FN2CGraphPassResult Total;
+        for (int32 GraphIndex = 0; GraphIndex < Graphs.Num(); ++GraphIndex)
         {
-            FN2CLogger::Get().LogWarning(TEXT("Detected loop in knot node chain"));
-            return nullptr;
+            FN2CGraph& Graph = Graphs[GraphIndex];
+
+            FN2CGraphPassResult Result;
+            if (Pass->Run(Graph, Result) && bMeasureSizes)
+            {
+                const int32 NewSize = FN2CSerializer::GetCondensedGraphSize(Graph);
+                Result.BytesSaved = GraphSizes[GraphIndex] - NewSize;
+                GraphSizes[GraphIndex] = NewSize;
+
+                FN2CLogger::Get().Log(FString::Printf(TEXT("%s: removed %d nodes, %d pins and %d values from graph %s (%d bytes)"),
+                    Pass->GetName(), Result.NodesRemoved, Result.PinsRemoved, Result.ValuesRemoved, *Graph.Name,
+                    Result.BytesSaved), EN2CLogSeverity::Debug);
+            }
+            Total += Result;
         }
-        VisitedNodes.Add(OwningNode);
 
-        // If this isn't a knot node, we've found our target
-        if (!OwningNode->IsA<UK2Node_Knot>())
+        const FString BytesSaved = bMeasureSizes ? FString::Printf(TEXT("%d bytes and "), Total.BytesSaved) : FString();
+        FN2CLogger::Get().Log(FString::Printf(TEXT("%s pass complete"), Pass->GetName()), EN2CLogSeverity::Info,
+            FString::Printf(TEXT("%d nodes, %d pins, %d values and %d edges removed, %s~%d tokens saved in %.2f ms"),
+                Total.NodesRemoved,
+                Total.PinsRemoved,
+                Total.ValuesRemoved,
+                Total.EdgesRemoved,
+                *BytesSaved,
+                Total.TokensSaved,
+                (FPlatformTime::Seconds() - PassStartTime) * 1000.0));
+    }
+}
+
+void FN2CNodeTranslator::PartitionEventGraphs(TArray<FN2CGraph>& Graphs)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FN2CGraph> Partitioned;
+    Partitioned.Reserve(Graphs.Num());
+    TArray<FN2CGraph> Units;
+    int32 NumSplit = 0;
+
+    for (FN2CGraph& Graph : Graphs)
+    {
+        if (Graph.GraphType != EN2CGraphType::EventGraph || !FN2CGraphPartitioner::Partition(Graph, Units))
         {
-            return CurrentPin;
+            Partitioned.Add(MoveTemp(Graph));
+            continue;
         }
 
-        // For knot nodes, follow to the next connection
-        // Knots should only have one connection on the opposite side
-        TArray<UEdGraphPin*>& LinkedPins = (CurrentPin->Direction == EGPD_Input) ? 
-            OwningNode->Pins[1]->LinkedTo : OwningNode->Pins[0]->LinkedTo;
+        FN2CLogger::Get().Log(FString::Printf(TEXT("Split graph %s into %d graphs"), *Graph.Name, Units.Num()),
+            EN2CLogSeverity::Debug);
 
-        if (LinkedPins.Num() == 0)
+        ++NumSplit;
+        for (FN2CGraph& Unit : Units)
         {
-            return nullptr;  // Dead end
+            Partitioned.Add(MoveTemp(Unit));
         }
+    }
 
-        CurrentPin = LinkedPins[0];
+    if (NumSplit == 0)
+    {
+        return;
     }
 
-    return nullptr;
+    const int32 NumGraphsBefore = Graphs.Num();
+    Graphs = MoveTemp(Partitioned);
+
+    FN2CLogger::Get().Log(TEXT("Event graph partitioning complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d event graphs split, %d graphs became %d in %.2f ms"),
+            NumSplit,
+            NumGraphsBefore,
+            Graphs.Num(),
+            (FPlatformTime::Seconds() - StartTime) * 1000.0));
 }
 
-bool FN2CNodeTranslator::ValidateFlowReferences(FN2CGraph& Graph)
+void FN2CNodeTranslator::DeduplicateGraphs(FN2CBlueprint& Blueprint)
 {
-    // Use the blueprint validator to validate the graph
-    FN2CBlueprintValidator Validator;
-    FString ErrorMessage;
-    return Validator.ValidateFlowReferences(Graph, ErrorMessage);
+    const double StartTime = FPlatformTime::Seconds();
+
+    // First graph seen with each body hash
+    TMap<uint64, int32> Definitions;
+    TSet<int32> ReferencedDefinitions;
+    int32 NumDuplicates = 0;
+    int64 BytesSaved = 0;
+
+    for (int32 GraphIndex = 0; GraphIndex < Blueprint.Graphs.Num(); ++GraphIndex)
+    {
+        FN2CGraph& Graph = Blueprint.Graphs[GraphIndex];
+        Graph.DuplicateOf = INDEX_NONE;
+
+        // A reference is only smaller than a graph with a couple of nodes
+        if (Graph.Nodes.Num() < 2)
+        {
+            continue;
+        }
+
+        const int32* DefinitionIndex = Definitions.Find(Graph.BodyHash);
+        if (!DefinitionIndex)
+        {
+            Definitions.Add(Graph.BodyHash, GraphIndex);
+            continue;
+        }
+
+        // Graphs that merely collide on the hash stay in full so every hash in the JSON stays unique
+        if (!FN2CGraphHasher::AreBodiesEqual(Blueprint.Graphs[*DefinitionIndex], Graph))
+        {
+            continue;
+        }
+
+        Graph.DuplicateOf = *DefinitionIndex;
+        ++NumDuplicates;
+
+        // The duplicate keeps its name and type plus a reference; its definition gains its hash once
+        const FString HashString = FN2CGraphHasher::HashToString(Graph.BodyHash);
+        const FString GraphType = StaticEnum<EN2CGraphType>()->GetNameStringByValue(static_cast<int64>(Graph.GraphType));
+        const int32 ReferenceSize = FString::Printf(TEXT("{\"name\":\"%s\",\"graph_type\":\"%s\",\"same_as\":\"%s\"}"),
+            *Graph.Name, *GraphType, *HashString).Len();
+
+        BytesSaved += FN2CSerializer::GetCondensedGraphSize(Graph) - ReferenceSize;
+
+        bool bAlreadyReferenced = false;
+        ReferencedDefinitions.Add(*DefinitionIndex, &bAlreadyReferenced);
+        if (!bAlreadyReferenced)
+        {
+            BytesSaved -= FString::Printf(TEXT(",\"hash\":\"%s\""), *HashString).Len();
+        }
+    }
+
+    if (NumDuplicates == 0)
+    {
+        return;
+    }
+
+    int64 GraphBytes = 0;
+    for (const FN2CGraph& Graph : Blueprint.Graphs)
+    {
+        GraphBytes += FN2CSerializer::GetCondensedGraphSize(Graph);
+    }
+
+    FN2CLogger::Get().Log(TEXT("Graph deduplication complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%d duplicate graphs refer to %d definitions, %lld of %lld graph bytes saved (%.1f%%) in %.2f ms"),
+            NumDuplicates,
+            ReferencedDefinitions.Num(),
+            BytesSaved,
+            GraphBytes,
+            GraphBytes > 0 ? 100.0 * BytesSaved / GraphBytes : 0.0,
+            (FPlatformTime::Seconds() - StartTime) * 1000.0));
 }
 
 void FN2CNodeTranslator::ProcessNodeTypeAndProperties(UK2Node* Node, FN2CNodeDefinition& OutNodeDef)
@@ -552,7 +1029,7 @@ void FN2CNodeTranslator::ProcessNodeTypeAndProperties(UK2Node* Node, FN2CNodeDef
             // Fall back to the old method if processor fails
             FallbackProcessNodeProperties(Node, OutNodeDef);
         }
-        else
+        else if (FN2CLogger::Get().IsSeverityEnabled(EN2CLogSeverity::Debug))
         {
             // Log successful processing
             FString NodeTypeName = StaticEnum<EN2CNodeType>()->GetNameStringByValue(static_cast<int64>(OutNodeDef.NodeType));
@@ -571,10 +1048,10 @@ void FN2CNodeTranslator::ProcessNodeTypeAndProperties(UK2Node* Node, FN2CNodeDef
         
         FallbackProcessNodeProperties(Node, OutNodeDef);
     }
+}
 
-    // Process any struct or enum types used in this node
-    ProcessRelatedTypes(Node, OutNodeDef);
-
+void FN2CNodeTranslator::DiscoverNodeGraphs(UK2Node* Node)
+{
     // Check for nested graphs that might need processing
     if (UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(Node))
     {
@@ -671,25 +1148,49 @@ void FN2CNodeTranslator::FallbackProcessNodeProperties(UK2Node* Node, FN2CNodeDe
     OutNodeDef.bPure = Node->IsNodePure();
 }
 
-void FN2CNodeTranslator::ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutNodeDef, TArray<UEdGraphPin*>& OutExecInputs, TArray<UEdGraphPin*>& OutExecOutputs)
+void FN2CNodeTranslator::ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutNodeDef, TArray<FN2CPinSnapshot>& OutPins)
 {
+    // Size the pin arrays up front so definitions are built in place
+    int32 NumVisibleInputs = 0;
+    int32 NumVisibleOutputs = 0;
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin && !Pin->bHidden)
+        {
+            ++(Pin->Direction == EGPD_Input ? NumVisibleInputs : NumVisibleOutputs);
+        }
+    }
+    OutPins.Reserve(Node->Pins.Num());
+    OutNodeDef.InputPins.Reserve(OutNodeDef.InputPins.Num() + NumVisibleInputs);
+    OutNodeDef.OutputPins.Reserve(OutNodeDef.OutputPins.Num() + NumVisibleOutputs);
+
+    const UK2Node_CreateDelegate* CreateDelegateNode = Cast<UK2Node_CreateDelegate>(Node);
+
     // Process input pins
     for (UEdGraphPin* Pin : Node->Pins)
     {
         if (!Pin) continue;
 
-        // Skip hidden pins entirely
+        const FEdGraphPinType& PinType = Pin->PinType;
+        const bool bIsInput = Pin->Direction == EGPD_Input;
+
+        // Record every pin so links can be resolved when the graph is built
+        FN2CPinSnapshot& PinSnapshot = OutPins.AddDefaulted_GetRef();
+        PinSnapshot.PinId = Pin->PinId;
+        PinSnapshot.bIsInput = bIsInput;
+        PinSnapshot.bIsExec = PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+        SnapshotPinLinks(Pin, PinSnapshot);
+
+        // Hidden pins get no definition
         if (Pin->bHidden)
         {
             continue;
         }
 
-        FN2CPinDefinition PinDef;
-        
-        // Generate and map pin ID (using local counter for this node)
-        FString PinID = GeneratePinID(OutNodeDef.InputPins.Num() + OutNodeDef.OutputPins.Num());
-        PinIDMap.Add(Pin->PinId, PinID);
-        PinDef.ID = PinID;
+        // Build the definition directly in the appropriate pin array
+        TArray<FN2CPinDefinition>& PinDefs = bIsInput ? OutNodeDef.InputPins : OutNodeDef.OutputPins;
+        PinSnapshot.DefinitionIndex = PinDefs.AddDefaulted();
+        FN2CPinDefinition& PinDef = PinDefs[PinSnapshot.DefinitionIndex];
         
         // Set pin name
         PinDef.Name = Pin->GetDisplayName().ToString();
@@ -699,11 +1200,11 @@ void FN2CNodeTranslator::ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutN
         
         // Set pin metadata
         PinDef.bConnected = Pin->LinkedTo.Num() > 0;
-        PinDef.bIsReference = Pin->PinType.bIsReference;
-        PinDef.bIsConst = Pin->PinType.bIsConst;
-        PinDef.bIsArray = Pin->PinType.ContainerType == EPinContainerType::Array;
-        PinDef.bIsMap = Pin->PinType.ContainerType == EPinContainerType::Map;
-        PinDef.bIsSet = Pin->PinType.ContainerType == EPinContainerType::Set;
+        PinDef.bIsReference = PinType.bIsReference;
+        PinDef.bIsConst = PinType.bIsConst;
+        PinDef.bIsArray = PinType.ContainerType == EPinContainerType::Array;
+        PinDef.bIsMap = PinType.ContainerType == EPinContainerType::Map;
+        PinDef.bIsSet = PinType.ContainerType == EPinContainerType::Set;
 
         // Get default value if any
         if (!Pin->DefaultValue.IsEmpty())
@@ -718,190 +1219,36 @@ void FN2CNodeTranslator::ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutN
         {
             PinDef.DefaultValue = Pin->DefaultTextValue.ToString();
         }
+
+        // Remember what graph passes need to tell redundant pins apart
+        PinDef.bIsSelfTarget = bIsInput && Pin->PinName == UEdGraphSchema_K2::PN_Self;
+        PinDef.bHasAutogeneratedDefault = !Pin->DefaultObject && Pin->DefaultTextValue.IsEmpty()
+            && Pin->DoesDefaultValueMatchAutogenerated();
         
         // Set subtype for container/object types
-        if (UK2Node_CreateDelegate* CreateDelegateNode = Cast<UK2Node_CreateDelegate>(Node))
+        if (CreateDelegateNode)
         {
             // For delegate output pin on CreateDelegate node, use function name as subtype
-            if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory == TEXT("delegate"))
-            {
-                PinDef.SubType = GetCleanClassName(CreateDelegateNode->GetFunctionName().ToString());
-            }
-            
-            if (Pin->Direction == EGPD_Input && Pin->PinType.PinCategory == TEXT("object"))
-            {
-                PinDef.SubType = GetCleanClassName(CreateDelegateNode->GetScopeClass()->GetName());
-            }
-        }
-        else if (Pin->PinType.PinSubCategoryObject.IsValid())
-        {
-            PinDef.SubType = GetCleanClassName(Pin->PinType.PinSubCategoryObject->GetName());
-        }
-        else if (!Pin->PinType.PinSubCategory.IsNone())
-        {
-            PinDef.SubType = GetCleanClassName(Pin->PinType.PinSubCategory.ToString());
-        }
-        
-        // Add to appropriate pin array
-        if (Pin->Direction == EGPD_Input)
-        {
-            OutNodeDef.InputPins.Add(PinDef);
-            
-            if (Pin->PinType.PinCategory == TEXT("exec"))
+            if (!bIsInput && PinType.PinCategory == UEdGraphSchema_K2::PC_Delegate)
             {
-                OutExecInputs.Add(Pin);
-                FString PinContext = FString::Printf(TEXT("Found exec input pin: %s on node %s"),
-                    *Pin->GetDisplayName().ToString(),
-                    *Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-                FN2CLogger::Get().Log(PinContext, EN2CLogSeverity::Debug);
+                PinDef.SubType = GetCleanName(CreateDelegateNode->GetFunctionName());
             }
-        }
-        else if (Pin->Direction == EGPD_Output)
-        {
-            OutNodeDef.OutputPins.Add(PinDef);
             
-            // Track execution outputs
-            if (Pin->PinType.PinCategory == TEXT("exec"))
+            if (bIsInput && PinType.PinCategory == UEdGraphSchema_K2::PC_Object)
             {
-                OutExecOutputs.Add(Pin);
-                FString PinContext = FString::Printf(TEXT("Found exec output pin: %s on node %s"),
-                    *Pin->GetDisplayName().ToString(),
-                    *Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-                FN2CLogger::Get().Log(PinContext, EN2CLogSeverity::Debug);
+                if (const UClass* ScopeClass = CreateDelegateNode->GetScopeClass())
+                {
+                    PinDef.SubType = GetCleanName(ScopeClass->GetFName());
+                }
             }
         }
-    }
-}
-
-void FN2CNodeTranslator::ProcessNodeFlows(UK2Node* Node, const TArray<UEdGraphPin*>& ExecInputs, const TArray<UEdGraphPin*>& ExecOutputs)
-{
-    // Record execution flows
-    FString ExecDebug = FString::Printf(TEXT("Node %s has %d exec outputs"), 
-        *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-        ExecOutputs.Num());
-    FN2CLogger::Get().Log(ExecDebug, EN2CLogSeverity::Debug);
-
-    for (UEdGraphPin* ExecOutput : ExecOutputs)
-    {
-        if (!ExecOutput) continue;
-
-        FString PinDebug = FString::Printf(TEXT("Exec output pin %s has %d connections"), 
-            *ExecOutput->GetDisplayName().ToString(),
-            ExecOutput->LinkedTo.Num());
-        FN2CLogger::Get().Log(PinDebug, EN2CLogSeverity::Debug);
-
-        for (UEdGraphPin* LinkedPin : ExecOutput->LinkedTo)
+        else if (const UObject* SubCategoryObject = PinType.PinSubCategoryObject.Get())
         {
-            if (!LinkedPin) 
-            {
-                FN2CLogger::Get().Log(TEXT("Found null linked pin"), EN2CLogSeverity::Warning);
-                continue;
-            }
-
-            // Trace through any knot nodes to find the actual target
-            UEdGraphPin* ActualTargetPin = TraceConnectionThroughKnots(LinkedPin);
-            if (!ActualTargetPin)
-            {
-                FN2CLogger::Get().Log(TEXT("Could not find valid target through knot chain"), EN2CLogSeverity::Warning);
-                continue;
-            }
-
-            UEdGraphNode* TargetNode = ActualTargetPin->GetOwningNode();
-            if (!TargetNode)
-            {
-                FN2CLogger::Get().Log(TEXT("Found null target node"), EN2CLogSeverity::Warning);
-                continue;
-            }
-
-            // Get or generate IDs for the nodes
-            FString SourceNodeID = NodeIDMap.FindRef(Node->NodeGuid);
-            FString TargetNodeID = NodeIDMap.FindRef(TargetNode->NodeGuid);
-            
-            if (SourceNodeID.IsEmpty())
-            {
-                SourceNodeID = GenerateNodeID();
-                NodeIDMap.Add(Node->NodeGuid, SourceNodeID);
-                FN2CLogger::Get().Log(TEXT("Generated new source node ID"), EN2CLogSeverity::Debug);
-            }
-            
-            if (TargetNodeID.IsEmpty())
-            {
-                TargetNodeID = GenerateNodeID();
-                NodeIDMap.Add(TargetNode->NodeGuid, TargetNodeID);
-                FN2CLogger::Get().Log(TEXT("Generated new target node ID"), EN2CLogSeverity::Debug);
-            }
-
-            // Add execution flow
-            FString FlowStr = FString::Printf(TEXT("%s->%s"), *SourceNodeID, *TargetNodeID);
-            CurrentGraph->Flows.Execution.AddUnique(FlowStr);
-            
-            // Log execution flow
-            FString FlowContext = FString::Printf(TEXT("Added execution flow: %s (%s) -> %s (%s)"),
-                *SourceNodeID, *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-                *TargetNodeID, *TargetNode->GetNodeTitle(ENodeTitleType::ListView).ToString());
-            FN2CLogger::Get().Log(FlowContext, EN2CLogSeverity::Debug);
+            PinDef.SubType = GetCleanName(SubCategoryObject->GetFName());
         }
-    }
-
-    // Record data flows
-    for (UEdGraphPin* Pin : Node->Pins)
-    {
-        if (Pin && Pin->PinType.PinCategory != TEXT("exec"))
+        else if (!PinType.PinSubCategory.IsNone())
         {
-            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-            {
-                // Trace through any knot nodes to find the actual source and target
-                UEdGraphPin* ActualSourcePin = Pin;
-                UEdGraphPin* ActualTargetPin = TraceConnectionThroughKnots(LinkedPin);
-                
-                if (ActualSourcePin && ActualTargetPin && 
-                    ActualSourcePin->GetOwningNode() && ActualTargetPin->GetOwningNode())
-                {
-                    // Get node and pin IDs
-                    FString SourceNodeID = NodeIDMap.FindRef(ActualSourcePin->GetOwningNode()->NodeGuid);
-                    FString SourcePinID = PinIDMap.FindRef(ActualSourcePin->PinId);
-                    FString TargetNodeID = NodeIDMap.FindRef(ActualTargetPin->GetOwningNode()->NodeGuid);
-                    FString TargetPinID = PinIDMap.FindRef(ActualTargetPin->PinId);
-                    
-                    if (!SourceNodeID.IsEmpty() && !SourcePinID.IsEmpty() && 
-                        !TargetNodeID.IsEmpty() && !TargetPinID.IsEmpty())
-                    {
-                        // Add data flow (always store as output->input direction)
-                        FString SourceRef = FString::Printf(TEXT("%s.%s"), *SourceNodeID, *SourcePinID);
-                        FString TargetRef = FString::Printf(TEXT("%s.%s"), *TargetNodeID, *TargetPinID);
-                
-                        // Always store flow from output pin to input pin
-                        if (ActualSourcePin->Direction == EGPD_Output)
-                        {
-                            CurrentGraph->Flows.Data.Add(SourceRef, TargetRef);
-                    
-                            // Log data flow
-                            FString FlowContext = FString::Printf(TEXT("Added data flow: %s.%s (%s.%s) -> %s.%s (%s.%s)"),
-                                *SourceNodeID, *SourcePinID, 
-                                *ActualSourcePin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString(), 
-                                *ActualSourcePin->GetDisplayName().ToString(),
-                                *TargetNodeID, *TargetPinID,
-                                *ActualTargetPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-                                *ActualTargetPin->GetDisplayName().ToString());
-                            FN2CLogger::Get().Log(FlowContext, EN2CLogSeverity::Debug);
-                        }
-                        else
-                        {
-                            CurrentGraph->Flows.Data.Add(TargetRef, SourceRef);
-                    
-                            // Log data flow
-                            FString FlowContext = FString::Printf(TEXT("Added data flow: %s.%s (%s.%s) -> %s.%s (%s.%s)"),
-                                *TargetNodeID, *TargetPinID,
-                                *ActualTargetPin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-                                *ActualTargetPin->GetDisplayName().ToString(),
-                                *SourceNodeID, *SourcePinID,
-                                *ActualSourcePin->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-                                *ActualSourcePin->GetDisplayName().ToString());
-                            FN2CLogger::Get().Log(FlowContext, EN2CLogSeverity::Debug);
-                        }
-                    }
-                }
-            }
+            PinDef.SubType = GetCleanName(PinType.PinSubCategory);
         }
     }
 }
@@ -920,13 +1267,16 @@ FN2CEnum FN2CNodeTranslator::ProcessBlueprintEnum(UEnum* Enum)
     FString EnumPath = Enum->GetPathName();
     FString EnumName = Enum->GetName();
     
-    FN2CLogger::Get().Log(
-        FString::Printf(TEXT("ProcessBlueprintEnum: Processing enum '%s' (Path: %s)"), 
-            *EnumName, *EnumPath),
-        EN2CLogSeverity::Info);
-    
-    // Check if we've already processed this enum
-    if (ProcessedEnumPaths.Contains(EnumPath))
+    if (FN2CGraphCache::FEntry* Recording = GetRecordingCacheEntry())
+    {
+        Recording->ReferencedTypes.AddUnique(Enum);
+    }
+
+    // Check if we've already processed this enum, marking it as processed if not
+    bool bAlreadyProcessed = false;
+    Session->ProcessedEnums.Add(Enum, &bAlreadyProcessed);
+    Session->AddReadPackage(Enum);
+    if (bAlreadyProcessed)
     {
         FN2CLogger::Get().Log(
             FString::Printf(TEXT("Enum %s already processed - skipping"), *EnumPath),
@@ -934,9 +1284,23 @@ FN2CEnum FN2CNodeTranslator::ProcessBlueprintEnum(UEnum* Enum)
         return Result;
     }
     
-    // Mark as processed
-    ProcessedEnumPaths.Add(EnumPath);
-    FN2CLogger::Get().Log(TEXT("Added enum to processed paths"), EN2CLogSeverity::Debug);
+    // Reuse the definition from a previous translation if the enum has not changed since
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bUseCache = Settings && Settings->bEnableTypeCache;
+    if (const FN2CTypeCache::FEnumEntry* CachedEntry = bUseCache ? FN2CTypeCache::Get().FindEnum(Enum) : nullptr)
+    {
+        ++Session->TypeCacheHits;
+        FN2CLogger::Get().Log(
+            FString::Printf(TEXT("Enum %s reused from type cache"), *EnumName),
+            EN2CLogSeverity::Debug);
+        return CachedEntry->Definition;
+    }
+    ++Session->TypeCacheMisses;
+
+    FN2CLogger::Get().Log(
+        FString::Printf(TEXT("ProcessBlueprintEnum: Processing enum '%s' (Path: %s)"), 
+            *EnumName, *EnumPath),
+        EN2CLogSeverity::Info);
     
     // Set basic enum info
     Result.Name = EnumName;
@@ -1011,10 +1375,25 @@ FN2CEnum FN2CNodeTranslator::ProcessBlueprintEnum(UEnum* Enum)
             *Result.Name, 
             Result.Values.Num()),
         EN2CLogSeverity::Info);
+
+    if (bUseCache)
+    {
+        FN2CTypeCache::Get().StoreEnum(Enum, Result);
+    }
     
     return Result;
 }
 
+const FString& FN2CNodeTranslator::GetCleanName(FName InName)
+{
+    if (const FString* CleanName = CleanNameCache.Find(InName))
+    {
+        return *CleanName;
+    }
+
+    return CleanNameCache.Add(InName, GetCleanClassName(InName.ToString()));
+}
+
 FString FN2CNodeTranslator::GetCleanClassName(const FString& InName)
 {
     FString CleanName = InName;                                                                                                                                                                      
@@ -1192,7 +1571,7 @@ void FN2CNodeTranslator::ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition&
                 FN2CStruct StructDef = ProcessBlueprintStruct(Struct);
                 if (StructDef.IsValid())
                 {
-                    N2CBlueprint.Structs.Add(StructDef);
+                    Session->N2CBlueprint.Structs.Add(StructDef);
                     
                     FN2CLogger::Get().Log(
                         FString::Printf(TEXT("Added Blueprint struct %s from struct operation node"), 
@@ -1214,7 +1593,7 @@ void FN2CNodeTranslator::ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition&
                 FN2CStruct StructDef = ProcessBlueprintStruct(Struct);
                 if (StructDef.IsValid())
                 {
-                    N2CBlueprint.Structs.Add(StructDef);
+                    Session->N2CBlueprint.Structs.Add(StructDef);
                     
                     FN2CLogger::Get().Log(
                         FString::Printf(TEXT("Added Blueprint struct %s from make struct node"), 
@@ -1236,7 +1615,7 @@ void FN2CNodeTranslator::ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition&
                 FN2CStruct StructDef = ProcessBlueprintStruct(Struct);
                 if (StructDef.IsValid())
                 {
-                    N2CBlueprint.Structs.Add(StructDef);
+                    Session->N2CBlueprint.Structs.Add(StructDef);
                     
                     FN2CLogger::Get().Log(
                         FString::Printf(TEXT("Added Blueprint struct %s from break struct node"), 
@@ -1262,7 +1641,7 @@ void FN2CNodeTranslator::ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition&
                 FN2CStruct StructDef = ProcessBlueprintStruct(Struct);
                 if (StructDef.IsValid())
                 {
-                    N2CBlueprint.Structs.Add(StructDef);
+                    Session->N2CBlueprint.Structs.Add(StructDef);
                     
                     FN2CLogger::Get().Log(
                         FString::Printf(TEXT("Added Blueprint struct %s from pin type"), 
@@ -1282,7 +1661,7 @@ void FN2CNodeTranslator::ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition&
                 FN2CEnum EnumDef = ProcessBlueprintEnum(Enum);
                 if (EnumDef.IsValid())
                 {
-                    N2CBlueprint.Enums.Add(EnumDef);
+                    Session->N2CBlueprint.Enums.Add(EnumDef);
                     
                     FN2CLogger::Get().Log(
                         FString::Printf(TEXT("Added Blueprint enum %s from pin type"), 
@@ -1298,7 +1677,6 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
 {
     // Log detailed node info
     FString NodeInfo = FString::Printf(TEXT("Node Details:\n")
-        TEXT("  ID: %s\n")
         TEXT("  Name: %s\n")
         TEXT("  Type: %s\n")
         TEXT("  Member Parent: %s\n")
@@ -1308,7 +1686,6 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
         TEXT("  Latent: %s\n")
         TEXT("  Input Pins: %d\n")
         TEXT("  Output Pins: %d"),
-        *NodeDef.ID,
         *NodeDef.Name,
         *StaticEnum<EN2CNodeType>()->GetNameStringByValue(static_cast<int64>(NodeDef.NodeType)),
         *NodeDef.MemberParent,
@@ -1323,7 +1700,7 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
     NodeInfo += TEXT("\n  Input Pins:");
     for (const FN2CPinDefinition& Pin : NodeDef.InputPins)
     {
-        NodeInfo += FString::Printf(TEXT("\n    - Pin %s (%s):\n")
+        NodeInfo += FString::Printf(TEXT("\n    - Pin %s:\n")
             TEXT("      Type: %s\n")
             TEXT("      SubType: %s\n")
             TEXT("      Default: %s\n")
@@ -1333,7 +1710,6 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
             TEXT("      IsArray: %s\n")
             TEXT("      IsMap: %s\n")
             TEXT("      IsSet: %s"),
-            *Pin.ID,
             *Pin.Name,
             *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)),
             *Pin.SubType,
@@ -1349,7 +1725,7 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
     NodeInfo += TEXT("\n  Output Pins:");
     for (const FN2CPinDefinition& Pin : NodeDef.OutputPins)
     {
-        NodeInfo += FString::Printf(TEXT("\n    - Pin %s (%s):\n")
+        NodeInfo += FString::Printf(TEXT("\n    - Pin %s:\n")
             TEXT("      Type: %s\n")
             TEXT("      SubType: %s\n")
             TEXT("      Default: %s\n")
@@ -1359,7 +1735,6 @@ void FN2CNodeTranslator::LogNodeDetails(const FN2CNodeDefinition& NodeDef)
             TEXT("      IsArray: %s\n")
             TEXT("      IsMap: %s\n")
             TEXT("      IsSet: %s"),
-            *Pin.ID,
             *Pin.Name,
             *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)),
             *Pin.SubType,
@@ -1401,7 +1776,7 @@ FString FN2CNodeTranslator::CleanPropertyName(const FString& RawName) const
  return CleanName;
 }
 
-FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
+FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property, TArray<UField*>& OutReferencedTypes)
 {
     FN2CStructMember Member;
 
@@ -1451,20 +1826,10 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
                 FN2CLogger::Get().Log(FString::Printf(TEXT("  -> Array of struct: %s"), 
                     *Member.TypeName), EN2CLogSeverity::Debug);
 
-                // Process nested struct if it's Blueprint-defined
+                // Record nested struct if it's Blueprint-defined
                 if (IsBlueprintStruct(InnerStructProp->Struct))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined nested struct"), EN2CLogSeverity::Debug);
-                    FN2CStruct NestedStruct = ProcessBlueprintStruct(InnerStructProp->Struct);
-                    if (NestedStruct.IsValid())
-                    {
-                        N2CBlueprint.Structs.Add(NestedStruct);
-                        FN2CLogger::Get().Log(TEXT("  -> Added nested struct to blueprint"), EN2CLogSeverity::Debug);
-                    }
-                    else
-                    {
-                        FN2CLogger::Get().LogWarning(TEXT("  -> Nested struct validation failed"));
-                    }
+                    OutReferencedTypes.AddUnique(InnerStructProp->Struct);
                 }
             }
             else if (FEnumProperty* InnerEnumProp = CastField<FEnumProperty>(InnerProp))
@@ -1473,20 +1838,10 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
                 FN2CLogger::Get().Log(FString::Printf(TEXT("  -> Array of enum: %s"), 
                     *Member.TypeName), EN2CLogSeverity::Debug);
 
-                // Process enum if it's Blueprint-defined
+                // Record enum if it's Blueprint-defined
                 if (IsBlueprintEnum(InnerEnumProp->GetEnum()))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined nested enum"), EN2CLogSeverity::Debug);
-                    FN2CEnum NestedEnum = ProcessBlueprintEnum(InnerEnumProp->GetEnum());
-                    if (NestedEnum.IsValid())
-                    {
-                        N2CBlueprint.Enums.Add(NestedEnum);
-                        FN2CLogger::Get().Log(TEXT("  -> Added nested enum to blueprint"), EN2CLogSeverity::Debug);
-                    }
-                    else
-                    {
-                        FN2CLogger::Get().LogWarning(TEXT("  -> Nested enum validation failed"));
-                    }
+                    OutReferencedTypes.AddUnique(InnerEnumProp->GetEnum());
                 }
             }
         }
@@ -1520,30 +1875,20 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
             {
                 Member.KeyTypeName = KeyStructProp->Struct->GetName();
                 
-                // Process nested struct if it's Blueprint-defined
+                // Record nested struct if it's Blueprint-defined
                 if (IsBlueprintStruct(KeyStructProp->Struct))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined key struct"), EN2CLogSeverity::Debug);
-                    FN2CStruct NestedStruct = ProcessBlueprintStruct(KeyStructProp->Struct);
-                    if (NestedStruct.IsValid())
-                    {
-                        N2CBlueprint.Structs.Add(NestedStruct);
-                    }
+                    OutReferencedTypes.AddUnique(KeyStructProp->Struct);
                 }
             }
             else if (FEnumProperty* KeyEnumProp = CastField<FEnumProperty>(KeyProp))
             {
                 Member.KeyTypeName = KeyEnumProp->GetEnum()->GetName();
                 
-                // Process enum if it's Blueprint-defined
+                // Record enum if it's Blueprint-defined
                 if (IsBlueprintEnum(KeyEnumProp->GetEnum()))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined key enum"), EN2CLogSeverity::Debug);
-                    FN2CEnum NestedEnum = ProcessBlueprintEnum(KeyEnumProp->GetEnum());
-                    if (NestedEnum.IsValid())
-                    {
-                        N2CBlueprint.Enums.Add(NestedEnum);
-                    }
+                    OutReferencedTypes.AddUnique(KeyEnumProp->GetEnum());
                 }
             }
         }
@@ -1562,30 +1907,20 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
             {
                 Member.TypeName = ValueStructProp->Struct->GetName();
                 
-                // Process nested struct if it's Blueprint-defined
+                // Record nested struct if it's Blueprint-defined
                 if (IsBlueprintStruct(ValueStructProp->Struct))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined value struct"), EN2CLogSeverity::Debug);
-                    FN2CStruct NestedStruct = ProcessBlueprintStruct(ValueStructProp->Struct);
-                    if (NestedStruct.IsValid())
-                    {
-                        N2CBlueprint.Structs.Add(NestedStruct);
-                    }
+                    OutReferencedTypes.AddUnique(ValueStructProp->Struct);
                 }
             }
             else if (FEnumProperty* ValueEnumProp = CastField<FEnumProperty>(ValueProp))
             {
                 Member.TypeName = ValueEnumProp->GetEnum()->GetName();
                 
-                // Process enum if it's Blueprint-defined
+                // Record enum if it's Blueprint-defined
                 if (IsBlueprintEnum(ValueEnumProp->GetEnum()))
                 {
-                    FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined value enum"), EN2CLogSeverity::Debug);
-                    FN2CEnum NestedEnum = ProcessBlueprintEnum(ValueEnumProp->GetEnum());
-                    if (NestedEnum.IsValid())
-                    {
-                        N2CBlueprint.Enums.Add(NestedEnum);
-                    }
+                    OutReferencedTypes.AddUnique(ValueEnumProp->GetEnum());
                 }
             }
         }
@@ -1599,20 +1934,10 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
             FN2CLogger::Get().Log(FString::Printf(TEXT("  -> Struct type: %s (Path: %s)"), 
                 *Member.TypeName, *StructProp->Struct->GetPathName()), EN2CLogSeverity::Debug);
 
-            // Process nested struct if it's Blueprint-defined
+            // Record nested struct if it's Blueprint-defined
             if (IsBlueprintStruct(StructProp->Struct))
             {
-                FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined struct"), EN2CLogSeverity::Debug);
-                FN2CStruct NestedStruct = ProcessBlueprintStruct(StructProp->Struct);
-                if (NestedStruct.IsValid())
-                {
-                    N2CBlueprint.Structs.Add(NestedStruct);
-                    FN2CLogger::Get().Log(TEXT("  -> Added struct to blueprint"), EN2CLogSeverity::Debug);
-                }
-                else
-                {
-                    FN2CLogger::Get().LogWarning(TEXT("  -> Struct validation failed"));
-                }
+                OutReferencedTypes.AddUnique(StructProp->Struct);
             }
         }
         else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
@@ -1621,20 +1946,10 @@ FN2CStructMember FN2CNodeTranslator::ProcessStructMember(FProperty* Property)
             FN2CLogger::Get().Log(FString::Printf(TEXT("  -> Enum type: %s (Path: %s)"), 
                 *Member.TypeName, *EnumProp->GetEnum()->GetPathName()), EN2CLogSeverity::Debug);
 
-            // Process enum if it's Blueprint-defined
+            // Record enum if it's Blueprint-defined
             if (IsBlueprintEnum(EnumProp->GetEnum()))
             {
-                FN2CLogger::Get().Log(TEXT("  -> Processing blueprint-defined enum"));
-                FN2CEnum NestedEnum = ProcessBlueprintEnum(EnumProp->GetEnum());
-                if (NestedEnum.IsValid())
-                {
-                    N2CBlueprint.Enums.Add(NestedEnum);
-                    FN2CLogger::Get().Log(TEXT("  -> Added enum to blueprint"), EN2CLogSeverity::Debug);
-                }
-                else
-                {
-                    FN2CLogger::Get().LogWarning(TEXT("  -> Enum validation failed"));
-                }
+                OutReferencedTypes.AddUnique(EnumProp->GetEnum());
             }
         }
     }
@@ -1659,13 +1974,16 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
     FString StructPath = Struct->GetPathName();
     FString StructName = Struct->GetName();
     
-    FN2CLogger::Get().Log(
-        FString::Printf(TEXT("ProcessBlueprintStruct: Processing struct '%s' (Path: %s)"), 
-            *StructName, *StructPath),
-        EN2CLogSeverity::Info);
-    
-    // Check if we've already processed this struct
-    if (ProcessedStructPaths.Contains(StructPath))
+    if (FN2CGraphCache::FEntry* Recording = GetRecordingCacheEntry())
+    {
+        Recording->ReferencedTypes.AddUnique(Struct);
+    }
+
+    // Check if we've already processed this struct, marking it as processed if not
+    bool bAlreadyProcessed = false;
+    Session->ProcessedStructs.Add(Struct, &bAlreadyProcessed);
+    Session->AddReadPackage(Struct);
+    if (bAlreadyProcessed)
     {
         FN2CLogger::Get().Log(
             FString::Printf(TEXT("Struct %s already processed - skipping"), *StructPath),
@@ -1673,9 +1991,37 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
         return Result;
     }
     
-    // Mark as processed
-    ProcessedStructPaths.Add(StructPath);
-    FN2CLogger::Get().Log(TEXT("Added struct to processed paths"), EN2CLogSeverity::Debug);
+    // Reuse the definition from a previous translation if the struct has not changed since
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    const bool bUseCache = Settings && Settings->bEnableTypeCache;
+    if (const FN2CTypeCache::FStructEntry* CachedEntry = bUseCache ? FN2CTypeCache::Get().FindStruct(Struct) : nullptr)
+    {
+        ++Session->TypeCacheHits;
+        Result = CachedEntry->Definition;
+
+        // Copy the references out, adding them can store new cache entries
+        TArray<UField*> CachedReferences;
+        for (const TWeakObjectPtr<UField>& Type : CachedEntry->ReferencedTypes)
+        {
+            if (UField* ReferencedType = Type.Get())
+            {
+                CachedReferences.Add(ReferencedType);
+            }
+        }
+
+        FN2CLogger::Get().Log(
+            FString::Printf(TEXT("Struct %s reused from type cache"), *StructName),
+            EN2CLogSeverity::Debug);
+
+        AddReferencedTypes(CachedReferences);
+        return Result;
+    }
+    ++Session->TypeCacheMisses;
+
+    FN2CLogger::Get().Log(
+        FString::Printf(TEXT("ProcessBlueprintStruct: Processing struct '%s' (Path: %s)"), 
+            *StructName, *StructPath),
+        EN2CLogSeverity::Info);
     
     // Set basic struct info
     Result.Name = StructName;
@@ -1700,6 +2046,7 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
     FN2CLogger::Get().Log(TEXT("Beginning property iteration for struct members..."), EN2CLogSeverity::Debug);
     
     // Process struct members
+    TArray<UField*> ReferencedTypes;
     int32 PropertyCount = 0;
     for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
     {
@@ -1713,7 +2060,7 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
                     *Property->GetClass()->GetName()),
                 EN2CLogSeverity::Debug);
                 
-            FN2CStructMember Member = ProcessStructMember(Property);
+            FN2CStructMember Member = ProcessStructMember(Property, ReferencedTypes);
             Result.Members.Add(Member);
             
             FN2CLogger::Get().Log(
@@ -1750,7 +2097,7 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
                             *Property->GetClass()->GetName()),
                         EN2CLogSeverity::Debug);
                         
-                    FN2CStructMember Member = ProcessStructMember(Property);
+                    FN2CStructMember Member = ProcessStructMember(Property, ReferencedTypes);
                     Result.Members.Add(Member);
                 }
             }
@@ -1763,10 +2110,43 @@ FN2CStruct FN2CNodeTranslator::ProcessBlueprintStruct(UScriptStruct* Struct)
             Result.Members.Num(),
             PropertyCount),
         EN2CLogSeverity::Info);
+
+    if (bUseCache)
+    {
+        FN2CTypeCache::Get().StoreStruct(Struct, Result, ReferencedTypes);
+    }
+
+    // Nested types are added ahead of the struct that uses them
+    AddReferencedTypes(ReferencedTypes);
     
     return Result;
 }
 
+void FN2CNodeTranslator::AddReferencedTypes(const TArray<UField*>& ReferencedTypes)
+{
+    for (UField* Type : ReferencedTypes)
+    {
+        if (UScriptStruct* NestedStructType = Cast<UScriptStruct>(Type))
+        {
+            FN2CStruct NestedStruct = ProcessBlueprintStruct(NestedStructType);
+            if (NestedStruct.IsValid())
+            {
+                Session->N2CBlueprint.Structs.Add(NestedStruct);
+                FN2CLogger::Get().Log(TEXT("  -> Added nested struct to blueprint"), EN2CLogSeverity::Debug);
+            }
+        }
+        else if (UEnum* NestedEnumType = Cast<UEnum>(Type))
+        {
+            FN2CEnum NestedEnum = ProcessBlueprintEnum(NestedEnumType);
+            if (NestedEnum.IsValid())
+            {
+                Session->N2CBlueprint.Enums.Add(NestedEnum);
+                FN2CLogger::Get().Log(TEXT("  -> Added nested enum to blueprint"), EN2CLogSeverity::Debug);
+            }
+        }
+    }
+}
+
 void FN2CNodeTranslator::DetermineNodeSpecificProperties(UK2Node* Node, FN2CNodeDefinition& OutNodeDef)
 {
     if (!Node)
@@ -1,6 +1,7 @@
 // Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
 
 #include "Core/N2CSerializer.h"
+#include "Utils/N2CGraphHasher.h"
 #include "Utils/N2CLogger.h"
 
 // Initialize static members
@@ -76,6 +77,21 @@ void FN2CSerializer::SetIndentLevel(int32 Level)
     IndentLevel = FMath::Max(0, Level);
 }
 
+int32 FN2CSerializer::GetCondensedGraphSize(const FN2CGraph& Graph)
+{
+    TSharedPtr<FJsonObject> JsonObject = GraphToJsonObject(Graph, 0);
+    if (!JsonObject.IsValid())
+    {
+        return 0;
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
+
+    return FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer) ? OutputString.Len() : 0;
+}
+
 TSharedPtr<FJsonObject> FN2CSerializer::BlueprintToJsonObject(const FN2CBlueprint& Blueprint)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
@@ -91,15 +107,46 @@ TSharedPtr<FJsonObject> FN2CSerializer::BlueprintToJsonObject(const FN2CBlueprin
     MetadataObject->SetStringField(TEXT("blueprint_class"), Blueprint.Metadata.BlueprintClass);
     JsonObject->SetObjectField(TEXT("metadata"), MetadataObject);
 
-    // Add graphs array
-    TArray<TSharedPtr<FJsonValue>> GraphsArray;
+    // Graphs that duplicates refer to are identified by their hash
+    TSet<int32> ReferencedGraphs;
     for (const FN2CGraph& Graph : Blueprint.Graphs)
     {
-        TSharedPtr<FJsonObject> GraphObject = GraphToJsonObject(Graph);
+        if (Blueprint.Graphs.IsValidIndex(Graph.DuplicateOf))
+        {
+            ReferencedGraphs.Add(Graph.DuplicateOf);
+        }
+    }
+
+    // Add graphs array, numbering nodes across all graphs
+    TArray<TSharedPtr<FJsonValue>> GraphsArray;
+    int32 NodeIDBase = 0;
+    for (int32 GraphIndex = 0; GraphIndex < Blueprint.Graphs.Num(); ++GraphIndex)
+    {
+        const FN2CGraph& Graph = Blueprint.Graphs[GraphIndex];
+
+        // A duplicate only names the graph holding its body
+        if (Blueprint.Graphs.IsValidIndex(Graph.DuplicateOf))
+        {
+            TSharedPtr<FJsonObject> GraphObject = MakeShared<FJsonObject>();
+            GraphObject->SetStringField(TEXT("name"), Graph.Name);
+            GraphObject->SetStringField(TEXT("graph_type"),
+                StaticEnum<EN2CGraphType>()->GetNameStringByValue(static_cast<int64>(Graph.GraphType)));
+            GraphObject->SetStringField(TEXT("same_as"),
+                FN2CGraphHasher::HashToString(Blueprint.Graphs[Graph.DuplicateOf].BodyHash));
+            GraphsArray.Add(MakeShared<FJsonValueObject>(GraphObject));
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> GraphObject = GraphToJsonObject(Graph, NodeIDBase);
         if (GraphObject.IsValid())
         {
+            if (ReferencedGraphs.Contains(GraphIndex))
+            {
+                GraphObject->SetStringField(TEXT("hash"), FN2CGraphHasher::HashToString(Graph.BodyHash));
+            }
             GraphsArray.Add(MakeShared<FJsonValueObject>(GraphObject));
         }
+        NodeIDBase += Graph.Nodes.Num();
     }
     JsonObject->SetArrayField(TEXT("graphs"), GraphsArray);
 
@@ -130,7 +177,7 @@ TSharedPtr<FJsonObject> FN2CSerializer::BlueprintToJsonObject(const FN2CBlueprin
     return JsonObject;
 }
 
-TSharedPtr<FJsonObject> FN2CSerializer::GraphToJsonObject(const FN2CGraph& Graph)
+TSharedPtr<FJsonObject> FN2CSerializer::GraphToJsonObject(const FN2CGraph& Graph, int32 NodeIDBase)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
@@ -141,9 +188,10 @@ TSharedPtr<FJsonObject> FN2CSerializer::GraphToJsonObject(const FN2CGraph& Graph
 
     // Add nodes array
     TArray<TSharedPtr<FJsonValue>> NodesArray;
-    for (const FN2CNodeDefinition& Node : Graph.Nodes)
+    NodesArray.Reserve(Graph.Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
     {
-        TSharedPtr<FJsonObject> NodeObject = NodeToJsonObject(Node);
+        TSharedPtr<FJsonObject> NodeObject = NodeToJsonObject(Graph.Nodes[NodeIndex], NodeIndex, NodeIDBase);
         if (NodeObject.IsValid())
         {
             NodesArray.Add(MakeShared<FJsonValueObject>(NodeObject));
@@ -152,17 +200,17 @@ TSharedPtr<FJsonObject> FN2CSerializer::GraphToJsonObject(const FN2CGraph& Graph
     JsonObject->SetArrayField(TEXT("nodes"), NodesArray);
 
     // Add flows
-    JsonObject->SetObjectField(TEXT("flows"), FlowsToJsonObject(Graph.Flows));
+    JsonObject->SetObjectField(TEXT("flows"), FlowsToJsonObject(Graph, NodeIDBase));
 
     return JsonObject;
 }
 
-TSharedPtr<FJsonObject> FN2CSerializer::NodeToJsonObject(const FN2CNodeDefinition& Node)
+TSharedPtr<FJsonObject> FN2CSerializer::NodeToJsonObject(const FN2CNodeDefinition& Node, int32 NodeIndex, int32 NodeIDBase)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
     // Required fields
-    JsonObject->SetStringField(TEXT("id"), Node.ID);
+    JsonObject->SetStringField(TEXT("id"), MakeNodeID(NodeIndex, NodeIDBase));
     JsonObject->SetStringField(TEXT("type"), 
         StaticEnum<EN2CNodeType>()->GetNameStringByValue(static_cast<int64>(Node.NodeType)));
     JsonObject->SetStringField(TEXT("name"), Node.Name);
@@ -193,9 +241,9 @@ TSharedPtr<FJsonObject> FN2CSerializer::NodeToJsonObject(const FN2CNodeDefinitio
 
     // Add input pins array
     TArray<TSharedPtr<FJsonValue>> InputPinsArray;
-    for (const FN2CPinDefinition& Pin : Node.InputPins)
+    for (int32 PinIndex = 0; PinIndex < Node.InputPins.Num(); ++PinIndex)
     {
-        TSharedPtr<FJsonObject> PinObject = PinToJsonObject(Pin);
+        TSharedPtr<FJsonObject> PinObject = PinToJsonObject(Node.InputPins[PinIndex], PinIndex);
         if (PinObject.IsValid())
         {
             InputPinsArray.Add(MakeShared<FJsonValueObject>(PinObject));
@@ -205,9 +253,9 @@ TSharedPtr<FJsonObject> FN2CSerializer::NodeToJsonObject(const FN2CNodeDefinitio
 
     // Add output pins array
     TArray<TSharedPtr<FJsonValue>> OutputPinsArray;
-    for (const FN2CPinDefinition& Pin : Node.OutputPins)
+    for (int32 PinIndex = 0; PinIndex < Node.OutputPins.Num(); ++PinIndex)
     {
-        TSharedPtr<FJsonObject> PinObject = PinToJsonObject(Pin);
+        TSharedPtr<FJsonObject> PinObject = PinToJsonObject(Node.OutputPins[PinIndex], Node.InputPins.Num() + PinIndex);
         if (PinObject.IsValid())
         {
             OutputPinsArray.Add(MakeShared<FJsonValueObject>(PinObject));
@@ -218,12 +266,12 @@ TSharedPtr<FJsonObject> FN2CSerializer::NodeToJsonObject(const FN2CNodeDefinitio
     return JsonObject;
 }
 
-TSharedPtr<FJsonObject> FN2CSerializer::PinToJsonObject(const FN2CPinDefinition& Pin)
+TSharedPtr<FJsonObject> FN2CSerializer::PinToJsonObject(const FN2CPinDefinition& Pin, int32 PinIndex)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
     // Required fields
-    JsonObject->SetStringField(TEXT("id"), Pin.ID);
+    JsonObject->SetStringField(TEXT("id"), FString::Printf(TEXT("P%d"), PinIndex + 1));
     JsonObject->SetStringField(TEXT("name"), Pin.Name);
     
     // Only add type if not Exec
@@ -274,29 +322,119 @@ TSharedPtr<FJsonObject> FN2CSerializer::PinToJsonObject(const FN2CPinDefinition&
     return JsonObject;
 }
 
-TSharedPtr<FJsonObject> FN2CSerializer::FlowsToJsonObject(const FN2CFlows& Flows)
+TSharedPtr<FJsonObject> FN2CSerializer::FlowsToJsonObject(const FN2CGraph& Graph, int32 NodeIDBase)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 
-    // Add execution flows array
+    // Add execution flows array, joining straight runs into chains like "N1->N2->N3"
+    const TArray<FN2CExecEdge>& ExecEdges = Graph.Flows.Execution;
+    const int32 NumNodes = Graph.Nodes.Num();
+
+    // A node with exactly one execution edge in and one out sits inside a chain
+    TArray<int32> NumIncoming;
+    TArray<int32> NumOutgoing;
+    TArray<int32> OutgoingEdge;
+    NumIncoming.Init(0, NumNodes);
+    NumOutgoing.Init(0, NumNodes);
+    OutgoingEdge.Init(INDEX_NONE, NumNodes);
+    for (int32 EdgeIndex = 0; EdgeIndex < ExecEdges.Num(); ++EdgeIndex)
+    {
+        const FN2CExecEdge& Edge = ExecEdges[EdgeIndex];
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode))
+        {
+            ++NumOutgoing[Edge.SourceNode];
+            OutgoingEdge[Edge.SourceNode] = EdgeIndex;
+        }
+        if (Graph.Nodes.IsValidIndex(Edge.TargetNode))
+        {
+            ++NumIncoming[Edge.TargetNode];
+        }
+    }
+
+    auto IsChainLink = [&](int32 NodeIndex)
+    {
+        return Graph.Nodes.IsValidIndex(NodeIndex) && NumIncoming[NodeIndex] == 1 && NumOutgoing[NodeIndex] == 1;
+    };
+
+    TBitArray<> Emitted(false, ExecEdges.Num());
     TArray<TSharedPtr<FJsonValue>> ExecutionArray;
-    for (const FString& Flow : Flows.Execution)
+
+    auto EmitChain = [&](int32 EdgeIndex)
+    {
+        FString Chain = MakeNodeID(ExecEdges[EdgeIndex].SourceNode, NodeIDBase);
+        while (EdgeIndex != INDEX_NONE && !Emitted[EdgeIndex])
+        {
+            Emitted[EdgeIndex] = true;
+            const int32 TargetNode = ExecEdges[EdgeIndex].TargetNode;
+            Chain += TEXT("->");
+            Chain += MakeNodeID(TargetNode, NodeIDBase);
+            EdgeIndex = IsChainLink(TargetNode) ? OutgoingEdge[TargetNode] : INDEX_NONE;
+        }
+        ExecutionArray.Add(MakeShared<FJsonValueString>(MoveTemp(Chain)));
+    };
+
+    // Chains start wherever a run begins; whatever is left are loops made only of chain links
+    for (int32 EdgeIndex = 0; EdgeIndex < ExecEdges.Num(); ++EdgeIndex)
     {
-        ExecutionArray.Add(MakeShared<FJsonValueString>(Flow));
+        if (!IsChainLink(ExecEdges[EdgeIndex].SourceNode))
+        {
+            EmitChain(EdgeIndex);
+        }
+    }
+    for (int32 EdgeIndex = 0; EdgeIndex < ExecEdges.Num(); ++EdgeIndex)
+    {
+        if (!Emitted[EdgeIndex])
+        {
+            EmitChain(EdgeIndex);
+        }
     }
     JsonObject->SetArrayField(TEXT("execution"), ExecutionArray);
 
-    // Add data flows object
+    // Add data flows object, one key per source pin so fan-out keeps every target
     TSharedPtr<FJsonObject> DataFlowsObject = MakeShared<FJsonObject>();
-    for (const auto& DataFlow : Flows.Data)
+    const FN2CDataFlowIndex DataFlows(Graph);
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
     {
-        DataFlowsObject->SetStringField(DataFlow.Key, DataFlow.Value);
+        const int32 NumPins = Graph.Nodes[NodeIndex].NumPins();
+        for (int32 PinIndex = 0; PinIndex < NumPins; ++PinIndex)
+        {
+            const TArrayView<const FN2CDataFlowIndex::FTarget> Targets = DataFlows.GetTargets(NodeIndex, PinIndex);
+            if (Targets.Num() == 0)
+            {
+                continue;
+            }
+
+            const FString SourceRef = MakePinRef(NodeIndex, PinIndex, NodeIDBase);
+            if (Targets.Num() == 1)
+            {
+                DataFlowsObject->SetStringField(SourceRef, MakePinRef(Targets[0].Node, Targets[0].Pin, NodeIDBase));
+                continue;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> TargetArray;
+            TargetArray.Reserve(Targets.Num());
+            for (const FN2CDataFlowIndex::FTarget& Target : Targets)
+            {
+                TargetArray.Add(MakeShared<FJsonValueString>(MakePinRef(Target.Node, Target.Pin, NodeIDBase)));
+            }
+            DataFlowsObject->SetArrayField(SourceRef, TargetArray);
+        }
     }
     JsonObject->SetObjectField(TEXT("data"), DataFlowsObject);
 
     return JsonObject;
 }
 
+FString FN2CSerializer::MakeNodeID(int32 NodeIndex, int32 NodeIDBase)
+{
+    return FString::Printf(TEXT("N%d"), NodeIDBase + NodeIndex + 1);
+}
+
+FString FN2CSerializer::MakePinRef(int32 NodeIndex, int32 PinIndex, int32 NodeIDBase)
+{
+    return FString::Printf(TEXT("N%d.P%d"), NodeIDBase + NodeIndex + 1, PinIndex + 1);
+}
+
 TSharedPtr<FJsonObject> FN2CSerializer::StructToJsonObject(const FN2CStruct& Struct)
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
@@ -464,6 +602,7 @@ bool FN2CSerializer::ParseBlueprintFromJson(const TSharedPtr<FJsonObject>& JsonO
     int32 TotalGraphCount = GraphsArray->Num();
 
     OutBlueprint.Graphs.Empty();
+    TArray<int32> Duplicates;
     for (const TSharedPtr<FJsonValue>& GraphValue : *GraphsArray)
     {
         const TSharedPtr<FJsonObject>& GraphObject = GraphValue->AsObject();
@@ -475,6 +614,10 @@ bool FN2CSerializer::ParseBlueprintFromJson(const TSharedPtr<FJsonObject>& JsonO
         FN2CGraph Graph;
         if (ParseGraphFromJson(GraphObject, Graph))
         {
+            if (GraphObject->HasField(TEXT("same_as")))
+            {
+                Duplicates.Add(OutBlueprint.Graphs.Num());
+            }
             OutBlueprint.Graphs.Add(Graph);
             ValidGraphCount++;
         }
@@ -485,6 +628,29 @@ bool FN2CSerializer::ParseBlueprintFromJson(const TSharedPtr<FJsonObject>& JsonO
         }
     }
 
+    // Give duplicates the body of the graph they refer to
+    for (int32 DuplicateIndex : Duplicates)
+    {
+        FN2CGraph& Duplicate = OutBlueprint.Graphs[DuplicateIndex];
+        for (int32 GraphIndex = 0; GraphIndex < OutBlueprint.Graphs.Num(); ++GraphIndex)
+        {
+            const FN2CGraph& Definition = OutBlueprint.Graphs[GraphIndex];
+            if (Definition.BodyHash == Duplicate.BodyHash && !Duplicates.Contains(GraphIndex))
+            {
+                Duplicate.Nodes = Definition.Nodes;
+                Duplicate.Flows = Definition.Flows;
+                Duplicate.DuplicateOf = GraphIndex;
+                break;
+            }
+        }
+
+        if (Duplicate.DuplicateOf == INDEX_NONE)
+        {
+            FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Graph %s refers to an unknown graph"), *Duplicate.Name));
+            bHasPartialData = true;
+        }
+    }
+
     // Log deserialization results
     if (ValidGraphCount < TotalGraphCount)
     {
@@ -524,6 +690,19 @@ bool FN2CSerializer::ParseGraphFromJson(const TSharedPtr<FJsonObject>& JsonObjec
     }
     OutGraph.GraphType = static_cast<EN2CGraphType>(TypeValue);
 
+    // Duplicates carry no body; the Blueprint copies it from the graph with the matching hash
+    FString HashString;
+    if (JsonObject->TryGetStringField(TEXT("same_as"), HashString))
+    {
+        OutGraph.BodyHash = FN2CGraphHasher::HashFromString(HashString);
+        return OutGraph.BodyHash != 0;
+    }
+
+    if (JsonObject->TryGetStringField(TEXT("hash"), HashString))
+    {
+        OutGraph.BodyHash = FN2CGraphHasher::HashFromString(HashString);
+    }
+
     // Parse nodes array
     const TArray<TSharedPtr<FJsonValue>>* NodesArray;
     if (!JsonObject->TryGetArrayField(TEXT("nodes"), NodesArray))
@@ -532,6 +711,10 @@ bool FN2CSerializer::ParseGraphFromJson(const TSharedPtr<FJsonObject>& JsonObjec
         return false;
     }
 
+    // Map textual IDs to indices so flows can be resolved
+    TMap<FString, int32> NodeIndices;
+    TArray<TMap<FString, int32>> NodePinIndices;
+
     OutGraph.Nodes.Empty();
     for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
     {
@@ -542,9 +725,12 @@ bool FN2CSerializer::ParseGraphFromJson(const TSharedPtr<FJsonObject>& JsonObjec
         }
 
         FN2CNodeDefinition Node;
-        if (ParseNodeFromJson(NodeObject, Node))
+        FString NodeID;
+        TMap<FString, int32> PinIndices;
+        if (ParseNodeFromJson(NodeObject, Node, NodeID, PinIndices))
         {
-            OutGraph.Nodes.Add(Node);
+            NodeIndices.Add(NodeID, OutGraph.Nodes.Add(Node));
+            NodePinIndices.Add(MoveTemp(PinIndices));
         }
     }
 
@@ -556,10 +742,11 @@ bool FN2CSerializer::ParseGraphFromJson(const TSharedPtr<FJsonObject>& JsonObjec
         return false;
     }
 
-    return ParseFlowsFromJson(*FlowsObject, OutGraph.Flows);
+    return ParseFlowsFromJson(*FlowsObject, NodeIndices, NodePinIndices, OutGraph.Flows);
 }
 
-bool FN2CSerializer::ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CNodeDefinition& OutNode)
+bool FN2CSerializer::ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CNodeDefinition& OutNode,
+    FString& OutNodeID, TMap<FString, int32>& OutPinIndices)
 {
     if (!JsonObject.IsValid())
     {
@@ -576,7 +763,7 @@ bool FN2CSerializer::ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject
         return false;
     }
 
-    OutNode.ID = ID;
+    OutNodeID = ID;
     OutNode.Name = Name;
 
     // Optional fields
@@ -623,9 +810,11 @@ bool FN2CSerializer::ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject
         }
 
         FN2CPinDefinition Pin;
-        if (ParsePinFromJson(PinObject, Pin))
+        FString PinID;
+        if (ParsePinFromJson(PinObject, Pin, PinID))
         {
             OutNode.InputPins.Add(Pin);
+            OutPinIndices.Add(PinID, OutNode.InputPins.Num() - 1);
         }
     }
 
@@ -647,16 +836,18 @@ bool FN2CSerializer::ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject
         }
 
         FN2CPinDefinition Pin;
-        if (ParsePinFromJson(PinObject, Pin))
+        FString PinID;
+        if (ParsePinFromJson(PinObject, Pin, PinID))
         {
             OutNode.OutputPins.Add(Pin);
+            OutPinIndices.Add(PinID, OutNode.NumPins() - 1);
         }
     }
 
     return true;
 }
 
-bool FN2CSerializer::ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CPinDefinition& OutPin)
+bool FN2CSerializer::ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CPinDefinition& OutPin, FString& OutPinID)
 {
     if (!JsonObject.IsValid())
     {
@@ -673,7 +864,7 @@ bool FN2CSerializer::ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject,
         return false;
     }
 
-    OutPin.ID = ID;
+    OutPinID = ID;
     OutPin.Name = Name;
 
     // Convert type string to enum
@@ -714,7 +905,8 @@ bool FN2CSerializer::ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject,
     return true;
 }
 
-bool FN2CSerializer::ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CFlows& OutFlows)
+bool FN2CSerializer::ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObject, const TMap<FString, int32>& NodeIndices,
+    const TArray<TMap<FString, int32>>& NodePinIndices, FN2CFlows& OutFlows)
 {
     if (!JsonObject.IsValid())
     {
@@ -730,11 +922,33 @@ bool FN2CSerializer::ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObjec
     }
 
     OutFlows.Execution.Empty();
+    TSet<uint64> ExecEdges;
     for (const TSharedPtr<FJsonValue>& FlowValue : *ExecutionArray)
     {
-        if (FlowValue->Type == EJson::String)
+        if (FlowValue->Type != EJson::String)
         {
-            OutFlows.Execution.Add(FlowValue->AsString());
+            continue;
+        }
+
+        // Chains like "N1->N2->N3" become one edge per link
+        TArray<FString> FlowNodes;
+        FlowValue->AsString().ParseIntoArray(FlowNodes, TEXT("->"));
+        for (int32 Index = 0; Index + 1 < FlowNodes.Num(); ++Index)
+        {
+            const int32* SourceNode = NodeIndices.Find(FlowNodes[Index]);
+            const int32* TargetNode = NodeIndices.Find(FlowNodes[Index + 1]);
+            if (!SourceNode || !TargetNode)
+            {
+                FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Skipping execution flow with unknown node: %s"), *FlowValue->AsString()));
+                continue;
+            }
+
+            bool bAlreadyAdded = false;
+            ExecEdges.Add((static_cast<uint64>(*SourceNode) << 32) | static_cast<uint32>(*TargetNode), &bAlreadyAdded);
+            if (!bAlreadyAdded)
+            {
+                OutFlows.Execution.Add(FN2CExecEdge(*SourceNode, *TargetNode));
+            }
         }
     }
 
@@ -747,17 +961,69 @@ bool FN2CSerializer::ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObjec
     }
 
     OutFlows.Data.Empty();
+    TArray<FString> TargetRefs;
     for (const auto& DataFlow : (*DataFlowsObject)->Values)
     {
+        // A source pin maps to one target, or to an array of targets when it fans out
+        TargetRefs.Reset();
         if (DataFlow.Value->Type == EJson::String)
         {
-            OutFlows.Data.Add(DataFlow.Key, DataFlow.Value->AsString());
+            TargetRefs.Add(DataFlow.Value->AsString());
+        }
+        else if (DataFlow.Value->Type == EJson::Array)
+        {
+            for (const TSharedPtr<FJsonValue>& TargetValue : DataFlow.Value->AsArray())
+            {
+                if (TargetValue.IsValid() && TargetValue->Type == EJson::String)
+                {
+                    TargetRefs.Add(TargetValue->AsString());
+                }
+            }
+        }
+
+        for (const FString& TargetRef : TargetRefs)
+        {
+            FN2CDataEdge Edge;
+            if (!ParsePinRef(DataFlow.Key, NodeIndices, NodePinIndices, Edge.SourceNode, Edge.SourcePin) ||
+                !ParsePinRef(TargetRef, NodeIndices, NodePinIndices, Edge.TargetNode, Edge.TargetPin))
+            {
+                FN2CLogger::Get().LogWarning(FString::Printf(TEXT("Skipping data flow with unknown pin: %s -> %s"),
+                    *DataFlow.Key, *TargetRef));
+                continue;
+            }
+            OutFlows.Data.Add(Edge);
         }
     }
 
     return true;
 }
 
+bool FN2CSerializer::ParsePinRef(const FString& PinRef, const TMap<FString, int32>& NodeIndices,
+    const TArray<TMap<FString, int32>>& NodePinIndices, int32& OutNodeIndex, int32& OutPinIndex)
+{
+    FString NodeID, PinID;
+    if (!PinRef.Split(TEXT("."), &NodeID, &PinID))
+    {
+        return false;
+    }
+
+    const int32* NodeIndex = NodeIndices.Find(NodeID);
+    if (!NodeIndex)
+    {
+        return false;
+    }
+
+    const int32* PinIndex = NodePinIndices[*NodeIndex].Find(PinID);
+    if (!PinIndex)
+    {
+        return false;
+    }
+
+    OutNodeIndex = *NodeIndex;
+    OutPinIndex = *PinIndex;
+    return true;
+}
+
 bool FN2CSerializer::ParseStructFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CStruct& OutStruct)
 {
     if (!JsonObject.IsValid())
@@ -108,6 +108,43 @@ FString UN2CSettings::GetActiveModel() const
     }
 }
 
+int32 UN2CSettings::GetActiveContextWindow() const
+{
+    switch (Provider)
+    {
+        case EN2CLLMProvider::OpenAI:
+            return FN2CLLMModelUtils::GetContextWindow(OpenAI_Model);
+        case EN2CLLMProvider::Anthropic:
+            return FN2CLLMModelUtils::GetContextWindow(AnthropicModel);
+        case EN2CLLMProvider::Gemini:
+            return FN2CLLMModelUtils::GetContextWindow(Gemini_Model);
+        case EN2CLLMProvider::DeepSeek:
+            return FN2CLLMModelUtils::GetContextWindow(DeepSeekModel);
+        case EN2CLLMProvider::Ollama:
+            return OllamaConfig.NumCtx;
+        case EN2CLLMProvider::LMStudio:
+        default:
+            // LM Studio does not report the loaded model's context, assume a common default
+            return 32768;
+    }
+}
+
+int32 UN2CSettings::GetTranslationTokenBudget() const
+{
+    if (!bUseTokenBudget)
+    {
+        return 0;
+    }
+
+    if (TranslationTokenBudget > 0)
+    {
+        return TranslationTokenBudget;
+    }
+
+    // Leave the other half for the system prompt and the generated code
+    return GetActiveContextWindow() / 2;
+}
+
 void UN2CSettings::PreEditChange(FProperty* PropertyAboutToChange)
 {
     Super::PreEditChange(PropertyAboutToChange);
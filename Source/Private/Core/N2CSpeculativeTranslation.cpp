@@ -0,0 +1,265 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CSpeculativeTranslation.h"
+
+#include "Core/N2CSerializer.h"
+#include "Core/N2CSettings.h"
+#include "Core/N2CTranslationJob.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Package.h"
+#include "Utils/N2CLogger.h"
+
+FN2CSpeculativeTranslation& FN2CSpeculativeTranslation::Get()
+{
+    static FN2CSpeculativeTranslation Instance;
+    return Instance;
+}
+
+void FN2CSpeculativeTranslation::Initialize()
+{
+    if (!ObjectModifiedHandle.IsValid())
+    {
+        ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FN2CSpeculativeTranslation::HandleObjectModified);
+    }
+
+    if (!ObjectPropertyChangedHandle.IsValid())
+    {
+        ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this,
+            &FN2CSpeculativeTranslation::HandleObjectPropertyChanged);
+    }
+}
+
+void FN2CSpeculativeTranslation::Shutdown()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+        ObjectModifiedHandle.Reset();
+    }
+
+    if (ObjectPropertyChangedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+        ObjectPropertyChangedHandle.Reset();
+    }
+
+    Release();
+
+    if (InvalidatedClaimHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(InvalidatedClaimHandle);
+        InvalidatedClaimHandle.Reset();
+    }
+    InvalidatedClaim.Unbind();
+
+    for (const TSharedPtr<FN2CTranslationJob>& RetiredJob : RetiredJobs)
+    {
+        RetiredJob->Shutdown();
+    }
+    RetiredJobs.Empty();
+}
+
+void FN2CSpeculativeTranslation::Prepare(UBlueprint* InBlueprint)
+{
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    if (!InBlueprint || !Settings || !Settings->bSpeculativeTranslation)
+    {
+        return;
+    }
+
+    // Without a time slice the job would run in a single frame, which is worse than waiting for the click
+    if (Settings->TranslationTimeSliceMs <= 0.0f)
+    {
+        FN2CLogger::Get().Log(TEXT("Speculative translation needs a translation time slice, skipped"), EN2CLogSeverity::Debug);
+        return;
+    }
+
+    if (Blueprint.Get() == InBlueprint && (bReady || (Job.IsValid() && Job->IsRunning())))
+    {
+        return;
+    }
+
+    if (Blueprint.Get() != InBlueprint)
+    {
+        Release();
+        Blueprint = InBlueprint;
+        BlueprintCompiledHandle = InBlueprint->OnCompiled().AddRaw(this, &FN2CSpeculativeTranslation::HandleBlueprintCompiled);
+    }
+
+    Invalidate();
+
+    RetiredJobs.RemoveAll([](const TSharedPtr<FN2CTranslationJob>& RetiredJob)
+    {
+        return !RetiredJob->IsRunning();
+    });
+
+    Job = MakeShared<FN2CTranslationJob>(FText::FromString(InBlueprint->GetName()),
+        FOnN2CTranslationJobFinished::CreateRaw(this, &FN2CSpeculativeTranslation::HandleJobFinished));
+    Job->SetShowNotification(false);
+
+    FN2CLogger::Get().Log(TEXT("Speculative translation started"), EN2CLogSeverity::Debug, InBlueprint->GetName());
+    Job->StartBlueprintTranslation(InBlueprint);
+}
+
+bool FN2CSpeculativeTranslation::Claim(UBlueprint* InBlueprint, FOnN2CSpeculationClaimed OnClaimed)
+{
+    if (!InBlueprint || Blueprint.Get() != InBlueprint)
+    {
+        return false;
+    }
+
+    // The result stays warm, so translating again without edits skips the translator too
+    if (bReady)
+    {
+        FN2CLogger::Get().Log(TEXT("Using speculative translation"), EN2CLogSeverity::Info, InBlueprint->GetName());
+        OnClaimed.ExecuteIfBound(true, N2CBlueprint, JsonOutput);
+        return true;
+    }
+
+    if (Job.IsValid() && Job->IsRunning() && !HasPendingClaim())
+    {
+        FN2CLogger::Get().Log(TEXT("Waiting for speculative translation"), EN2CLogSeverity::Info, InBlueprint->GetName());
+        PendingClaim = MoveTemp(OnClaimed);
+        return true;
+    }
+
+    return false;
+}
+
+void FN2CSpeculativeTranslation::Invalidate()
+{
+    if (Job.IsValid() && Job->IsRunning())
+    {
+        Job->Cancel();
+
+        // A build still running on a worker keeps the job busy until it returns
+        if (Job->IsRunning())
+        {
+            RetiredJobs.Add(Job);
+        }
+    }
+    Job.Reset();
+
+    bReady = false;
+    N2CBlueprint = FN2CBlueprint();
+    JsonOutput.Empty();
+    PreparedPackages.Empty();
+
+    // Invalidation runs from Modify, before the edit is applied, so a fallback translation now would miss it
+    if (PendingClaim.IsBound())
+    {
+        InvalidatedClaim = MoveTemp(PendingClaim);
+        InvalidatedClaimHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FN2CSpeculativeTranslation::HandleInvalidatedClaim));
+    }
+}
+
+bool FN2CSpeculativeTranslation::HandleInvalidatedClaim(float DeltaTime)
+{
+    InvalidatedClaimHandle.Reset();
+
+    FOnN2CSpeculationClaimed Claim = MoveTemp(InvalidatedClaim);
+    Claim.ExecuteIfBound(false, FN2CBlueprint(), FString());
+    return false;
+}
+
+void FN2CSpeculativeTranslation::Release()
+{
+    Invalidate();
+
+    if (UBlueprint* OldBlueprint = Blueprint.Get())
+    {
+        OldBlueprint->OnCompiled().Remove(BlueprintCompiledHandle);
+    }
+    BlueprintCompiledHandle.Reset();
+    Blueprint.Reset();
+}
+
+void FN2CSpeculativeTranslation::HandleJobFinished(bool bSuccess, FN2CTranslationSession& Session)
+{
+    // The job stays referenced until the next Prepare, since it is still unwinding from this callback
+    if (bSuccess && Session.GetN2CBlueprint().IsValid())
+    {
+        N2CBlueprint = Session.TakeN2CBlueprint();
+        PreparedPackages = Session.GetReadPackages();
+
+        FN2CSerializer::SetPrettyPrint(false);
+        JsonOutput = FN2CSerializer::ToJson(N2CBlueprint);
+        bReady = !JsonOutput.IsEmpty();
+    }
+
+    if (bReady)
+    {
+        FN2CLogger::Get().Log(TEXT("Speculative translation ready"), EN2CLogSeverity::Debug,
+            FString::Printf(TEXT("%s, %d characters"), *N2CBlueprint.Metadata.Name, JsonOutput.Len()));
+    }
+    else
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Speculative translation failed"));
+        N2CBlueprint = FN2CBlueprint();
+        JsonOutput.Empty();
+        PreparedPackages.Empty();
+    }
+
+    if (PendingClaim.IsBound())
+    {
+        FOnN2CSpeculationClaimed Claim = MoveTemp(PendingClaim);
+        Claim.Execute(bReady, N2CBlueprint, JsonOutput);
+    }
+}
+
+bool FN2CSpeculativeTranslation::DependsOnPackage(const UPackage* Package) const
+{
+    const UBlueprint* PreparedBlueprint = Blueprint.Get();
+    if (!Package || !PreparedBlueprint)
+    {
+        return false;
+    }
+
+    if (Package == PreparedBlueprint->GetPackage())
+    {
+        return true;
+    }
+
+    if (bReady)
+    {
+        return PreparedPackages.Contains(Package->GetFName());
+    }
+
+    // Packages the job reads after this point are read with the edit already applied
+    const FN2CTranslationSession* Session = Job.IsValid() ? Job->GetSession() : nullptr;
+    return Session && Session->GetReadPackages().Contains(Package->GetFName());
+}
+
+void FN2CSpeculativeTranslation::HandleObjectModified(UObject* Object)
+{
+    if (!Object || (!bReady && !(Job.IsValid() && Job->IsRunning())))
+    {
+        return;
+    }
+
+    const UPackage* Package = Object->GetPackage();
+    if (DependsOnPackage(Package))
+    {
+        FN2CLogger::Get().Log(TEXT("Speculative translation invalidated by an edit"), EN2CLogSeverity::Debug,
+            Package->GetName());
+        Invalidate();
+    }
+}
+
+void FN2CSpeculativeTranslation::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    if (!Object || !Object->IsA<UN2CSettings>() || (!bReady && !(Job.IsValid() && Job->IsRunning())))
+    {
+        return;
+    }
+
+    // Depth, passes, partitioning and deduplication all shape the prepared result
+    FN2CLogger::Get().Log(TEXT("Speculative translation invalidated by a settings change"), EN2CLogSeverity::Debug);
+    Invalidate();
+}
+
+void FN2CSpeculativeTranslation::HandleBlueprintCompiled(UBlueprint* CompiledBlueprint)
+{
+    Prepare(CompiledBlueprint);
+}
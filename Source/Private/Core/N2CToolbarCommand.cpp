@@ -10,12 +10,18 @@
 
 const FName FN2CToolbarCommand::CommandName_Open = TEXT("NodeToCode_OpenWindow");
 const FName FN2CToolbarCommand::CommandName_Collect = TEXT("NodeToCode_CollectNodes");
+const FName FN2CToolbarCommand::CommandName_TranslateSelection = TEXT("NodeToCode_TranslateSelection");
+const FName FN2CToolbarCommand::CommandName_TranslateBlueprint = TEXT("NodeToCode_TranslateBlueprint");
 const FName FN2CToolbarCommand::CommandName_CopyJson = TEXT("NodeToCode_CopyJson");
 const FText FN2CToolbarCommand::CommandLabel_Open = NSLOCTEXT("NodeToCode", "OpenWindow", "Open Node to Code");
 const FText FN2CToolbarCommand::CommandLabel_Collect = NSLOCTEXT("NodeToCode", "CollectNodes", "Collect and Translate Nodes");
+const FText FN2CToolbarCommand::CommandLabel_TranslateSelection = NSLOCTEXT("NodeToCode", "TranslateSelection", "Translate Selected Nodes");
+const FText FN2CToolbarCommand::CommandLabel_TranslateBlueprint = NSLOCTEXT("NodeToCode", "TranslateBlueprint", "Translate Entire Blueprint");
 const FText FN2CToolbarCommand::CommandLabel_CopyJson = NSLOCTEXT("NodeToCode", "CopyJson", "Copy Blueprint JSON");
 const FText FN2CToolbarCommand::CommandTooltip_Open = NSLOCTEXT("NodeToCode", "OpenWindowTooltip", "Open the Node to Code window");
 const FText FN2CToolbarCommand::CommandTooltip_Collect = NSLOCTEXT("NodeToCode", "CollectNodesTooltip", "Collect nodes from current Blueprint graph and translate to code");
+const FText FN2CToolbarCommand::CommandTooltip_TranslateSelection = NSLOCTEXT("NodeToCode", "TranslateSelectionTooltip", "Translate the selected nodes and the nodes they take data from to code");
+const FText FN2CToolbarCommand::CommandTooltip_TranslateBlueprint = NSLOCTEXT("NodeToCode", "TranslateBlueprintTooltip", "Translate every graph of the current Blueprint to code in a single request");
 const FText FN2CToolbarCommand::CommandTooltip_CopyJson = NSLOCTEXT("NodeToCode", "CopyJsonTooltip", "Copy the serialized Blueprint JSON to clipboard");
 
 FN2CToolbarCommand::FN2CToolbarCommand()
@@ -48,6 +54,22 @@ void FN2CToolbarCommand::RegisterCommands()
         FInputChord()
     );
     
+    UI_COMMAND(
+        TranslateSelectionCommand,
+        "Translate Selected Nodes to Code",
+        "Translate the selected nodes of the current graph, along with every node they take data from.\nResults will be in the Node to Code Editor window.",
+        EUserInterfaceActionType::Button,
+        FInputChord()
+    );
+    
+    UI_COMMAND(
+        TranslateBlueprintCommand,
+        "Translate Entire Blueprint to Code",
+        "Translate all event graphs, functions, macros and delegate signatures of the current Blueprint in a single request.\nResults will be in the Node to Code Editor window.",
+        EUserInterfaceActionType::Button,
+        FInputChord()
+    );
+    
     UI_COMMAND(
     CopyJsonCommand,
     "Copy Blueprint JSON",
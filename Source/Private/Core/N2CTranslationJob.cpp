@@ -0,0 +1,263 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CTranslationJob.h"
+
+#include "Async/Async.h"
+#include "Core/N2CGraphBuilder.h"
+#include "Core/N2CNodeTranslator.h"
+#include "Core/N2CSettings.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Utils/N2CLogger.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "N2CTranslationJob"
+
+FN2CTranslationJob::FN2CTranslationJob(const FText& InLabel, FOnN2CTranslationJobFinished InOnFinished)
+    : FinishedDelegate(MoveTemp(InOnFinished))
+    , JobLabel(InLabel)
+{
+}
+
+bool FN2CTranslationJob::StartNodeTranslation(const TArray<UK2Node*>& CollectedNodes)
+{
+    if (IsRunning())
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Translation already in progress, please wait"));
+        return false;
+    }
+
+    Session = MakeUnique<FN2CTranslationSession>();
+    Session->SetRawGraphs(bRawGraphs);
+    return Start(FN2CNodeTranslator::Get().BeginNodeTranslation(*Session, CollectedNodes));
+}
+
+bool FN2CTranslationJob::StartBlueprintTranslation(UBlueprint* Blueprint)
+{
+    if (IsRunning())
+    {
+        FN2CLogger::Get().LogWarning(TEXT("Translation already in progress, please wait"));
+        return false;
+    }
+
+    Session = MakeUnique<FN2CTranslationSession>();
+    Session->SetRawGraphs(bRawGraphs);
+    return Start(FN2CNodeTranslator::Get().BeginBlueprintTranslation(*Session, Blueprint));
+}
+
+bool FN2CTranslationJob::Start(bool bBegun)
+{
+    if (!bBegun)
+    {
+        FinishedDelegate.ExecuteIfBound(false, *Session);
+        Session.Reset();
+        return false;
+    }
+
+    StartTime = FPlatformTime::Seconds();
+    NumSnapshotFrames = 0;
+
+    // Both paths build the same way; parallel unless the settings say otherwise
+    const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+    bParallelBuild = !Settings || Settings->bParallelGraphBuild;
+
+    // Without a time slice everything runs now, as before jobs existed
+    if (!Settings || Settings->TranslationTimeSliceMs <= 0.0f)
+    {
+        FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+        Translator.StepSnapshots(*Session, TNumericLimits<double>::Max());
+
+        TArray<FN2CGraph> Graphs;
+        FN2CGraphBuilder::BuildGraphs(Translator.TakeGraphSnapshots(*Session), Graphs, bParallelBuild);
+
+        Finish(Graphs);
+        return true;
+    }
+
+    Phase = EPhase::Snapshot;
+
+    if (bShowNotification)
+    {
+        FNotificationInfo Info(FText::Format(LOCTEXT("TranslatingTitle", "Translating {0}"), JobLabel));
+        Info.bFireAndForget = false;
+        Info.bUseThrobber = true;
+        Info.bUseSuccessFailIcons = true;
+        Info.FadeOutDuration = 0.5f;
+        Info.ExpireDuration = 2.0f;
+        Info.ButtonDetails.Add(FNotificationButtonInfo(
+            LOCTEXT("CancelButton", "Cancel"),
+            LOCTEXT("CancelButtonTooltip", "Stop this translation"),
+            FSimpleDelegate::CreateSP(this, &FN2CTranslationJob::Cancel),
+            SNotificationItem::CS_Pending));
+
+        Notification = FSlateNotificationManager::Get().AddNotification(Info);
+        if (Notification.IsValid())
+        {
+            Notification->SetCompletionState(SNotificationItem::CS_Pending);
+        }
+    }
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FN2CTranslationJob::Tick));
+
+    FN2CLogger::Get().Log(TEXT("Translation job started"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%s, %.1f ms per frame"), *JobLabel.ToString(), Settings->TranslationTimeSliceMs));
+
+    return true;
+}
+
+bool FN2CTranslationJob::Tick(float DeltaTime)
+{
+    FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+
+    switch (Phase)
+    {
+    case EPhase::Snapshot:
+    {
+        const UN2CSettings* Settings = GetDefault<UN2CSettings>();
+        const double TimeBudget = (Settings ? Settings->TranslationTimeSliceMs : 8.0f) / 1000.0;
+
+        ++NumSnapshotFrames;
+        if (Translator.StepSnapshots(*Session, TimeBudget))
+        {
+            StartBuild();
+        }
+        else
+        {
+            UpdateNotification(FText::Format(LOCTEXT("SnapshotProgress", "{0} / {1} nodes"),
+                FText::AsNumber(Session->GetNumNodesSnapshotted()),
+                FText::AsNumber(Session->GetNumNodesQueued())));
+        }
+        break;
+    }
+
+    case EPhase::Build:
+        if (BuildTask.IsReady())
+        {
+            TArray<FN2CGraph> Graphs = MoveTemp(*BuiltGraphs);
+            BuiltGraphs.Reset();
+            Finish(Graphs);
+        }
+        break;
+
+    case EPhase::Cancelling:
+        // The worker cannot be interrupted; its result is dropped once it returns
+        if (BuildTask.IsReady())
+        {
+            BuiltGraphs.Reset();
+            End(false);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // End removes the ticker itself
+    return true;
+}
+
+void FN2CTranslationJob::StartBuild()
+{
+    FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+
+    FN2CLogger::Get().Log(TEXT("Translation snapshots done"), EN2CLogSeverity::Debug,
+        FString::Printf(TEXT("%d nodes over %d frames"), Session->GetNumNodesSnapshotted(), NumSnapshotFrames));
+
+    UpdateNotification(FText::Format(LOCTEXT("BuildProgress", "Building graphs from {0} nodes"),
+        FText::AsNumber(Session->GetNumNodesSnapshotted())));
+
+    // The snapshots hold no UObjects, so the worker owns them outright
+    BuiltGraphs = MakeShared<TArray<FN2CGraph>, ESPMode::ThreadSafe>();
+    BuildTask = Async(EAsyncExecution::ThreadPool,
+        [Snapshots = Translator.TakeGraphSnapshots(*Session), Graphs = BuiltGraphs, bParallel = bParallelBuild]()
+        {
+            FN2CGraphBuilder::BuildGraphs(Snapshots, *Graphs, bParallel);
+        });
+
+    Phase = EPhase::Build;
+}
+
+void FN2CTranslationJob::Finish(TArray<FN2CGraph>& Graphs)
+{
+    const bool bSuccess = FN2CNodeTranslator::Get().CompleteTranslation(*Session, Graphs);
+
+    FN2CLogger::Get().Log(TEXT("Translation job complete"), EN2CLogSeverity::Info,
+        FString::Printf(TEXT("%s in %.2f ms over %d frames"),
+            *JobLabel.ToString(),
+            (FPlatformTime::Seconds() - StartTime) * 1000.0,
+            NumSnapshotFrames + 1));
+
+    // The callback may start the next job, so go idle first; the session lives until the callback returns
+    FOnN2CTranslationJobFinished Delegate = MoveTemp(FinishedDelegate);
+    TUniquePtr<FN2CTranslationSession> FinishedSession = MoveTemp(Session);
+    End(bSuccess);
+    Delegate.ExecuteIfBound(bSuccess, *FinishedSession);
+}
+
+void FN2CTranslationJob::Cancel()
+{
+    if (Phase == EPhase::Idle || Phase == EPhase::Cancelling)
+    {
+        return;
+    }
+
+    FN2CLogger::Get().Log(TEXT("Translation cancelled"), EN2CLogSeverity::Info, JobLabel.ToString());
+
+    Session.Reset();
+    FinishedDelegate.Unbind();
+
+    if (Phase == EPhase::Build && !BuildTask.IsReady())
+    {
+        Phase = EPhase::Cancelling;
+        UpdateNotification(LOCTEXT("Cancelling", "Cancelling"));
+        return;
+    }
+
+    BuiltGraphs.Reset();
+    End(false);
+}
+
+void FN2CTranslationJob::Shutdown()
+{
+    Cancel();
+
+    if (BuildTask.IsValid())
+    {
+        BuildTask.Wait();
+    }
+
+    BuiltGraphs.Reset();
+    End(false);
+}
+
+void FN2CTranslationJob::End(bool bSuccess)
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    if (Notification.IsValid())
+    {
+        Notification->SetText(FText::Format(bSuccess
+            ? LOCTEXT("TranslationSucceeded", "Translated {0}")
+            : LOCTEXT("TranslationStopped", "Translation of {0} stopped"), JobLabel));
+        Notification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+        Notification->ExpireAndFadeout();
+        Notification.Reset();
+    }
+
+    BuildTask = TFuture<void>();
+    Session.Reset();
+    Phase = EPhase::Idle;
+}
+
+void FN2CTranslationJob::UpdateNotification(const FText& Status)
+{
+    if (Notification.IsValid())
+    {
+        Notification->SetText(FText::Format(LOCTEXT("TranslatingProgress", "Translating {0}: {1}"), JobLabel, Status));
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
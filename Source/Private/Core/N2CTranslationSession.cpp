@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CTranslationSession.h"
+
+#include "K2Node.h"
+#include "UObject/Package.h"
+
+TWeakObjectPtr<UK2Node>* FN2CTranslationSession::AllocateNodeList(int32 Count)
+{
+    // The arena is released without running destructors, which weak pointers do not need
+    static_assert(std::is_trivially_destructible_v<TWeakObjectPtr<UK2Node>>, "Arena entries must not need destruction");
+
+    TWeakObjectPtr<UK2Node>* Nodes = reinterpret_cast<TWeakObjectPtr<UK2Node>*>(
+        Arena.PushBytes(sizeof(TWeakObjectPtr<UK2Node>) * FMath::Max(Count, 1), alignof(TWeakObjectPtr<UK2Node>)));
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        new (&Nodes[Index]) TWeakObjectPtr<UK2Node>();
+    }
+
+    return Nodes;
+}
+
+void FN2CTranslationSession::AddReadPackage(const UObject* Object)
+{
+    if (const UPackage* Package = Object ? Object->GetPackage() : nullptr)
+    {
+        ReadPackages.Add(Package->GetFName());
+    }
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CTypeCache.h"
+
+#include "UObject/Class.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/PackageReload.h"
+#include "Utils/N2CLogger.h"
+
+FN2CTypeCache& FN2CTypeCache::Get()
+{
+    static FN2CTypeCache Instance;
+    return Instance;
+}
+
+void FN2CTypeCache::Initialize()
+{
+    if (!ObjectModifiedHandle.IsValid())
+    {
+        ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FN2CTypeCache::HandleObjectModified);
+    }
+
+    if (!PackageSavedHandle.IsValid())
+    {
+        PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FN2CTypeCache::HandlePackageSaved);
+    }
+
+    if (!PackageReloadedHandle.IsValid())
+    {
+        PackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddRaw(this, &FN2CTypeCache::HandlePackageReloaded);
+    }
+}
+
+void FN2CTypeCache::Shutdown()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+        ObjectModifiedHandle.Reset();
+    }
+
+    if (PackageSavedHandle.IsValid())
+    {
+        UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+        PackageSavedHandle.Reset();
+    }
+
+    if (PackageReloadedHandle.IsValid())
+    {
+        FCoreUObjectDelegates::OnPackageReloaded.Remove(PackageReloadedHandle);
+        PackageReloadedHandle.Reset();
+    }
+
+    Clear();
+}
+
+const FN2CTypeCache::FStructEntry* FN2CTypeCache::FindStruct(const UScriptStruct* Struct) const
+{
+    return Struct ? Structs.Find(FObjectKey(Struct)) : nullptr;
+}
+
+const FN2CTypeCache::FEnumEntry* FN2CTypeCache::FindEnum(const UEnum* Enum) const
+{
+    return Enum ? Enums.Find(FObjectKey(Enum)) : nullptr;
+}
+
+void FN2CTypeCache::StoreStruct(const UScriptStruct* Struct, const FN2CStruct& Definition, const TArray<UField*>& ReferencedTypes)
+{
+    if (!Struct)
+    {
+        return;
+    }
+
+    FStructEntry& Entry = Structs.FindOrAdd(FObjectKey(Struct));
+    Entry.Definition = Definition;
+    Entry.Package = FObjectKey(Struct->GetPackage());
+
+    Entry.ReferencedTypes.Reset(ReferencedTypes.Num());
+    for (UField* Type : ReferencedTypes)
+    {
+        Entry.ReferencedTypes.Add(Type);
+    }
+}
+
+void FN2CTypeCache::StoreEnum(const UEnum* Enum, const FN2CEnum& Definition)
+{
+    if (!Enum)
+    {
+        return;
+    }
+
+    FEnumEntry& Entry = Enums.FindOrAdd(FObjectKey(Enum));
+    Entry.Definition = Definition;
+    Entry.Package = FObjectKey(Enum->GetPackage());
+}
+
+void FN2CTypeCache::InvalidatePackage(const UPackage* Package)
+{
+    const FObjectKey PackageKey(Package);
+
+    for (auto It = Structs.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Package == PackageKey)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    for (auto It = Enums.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Package == PackageKey)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FN2CTypeCache::Clear()
+{
+    Structs.Empty();
+    Enums.Empty();
+}
+
+void FN2CTypeCache::HandleObjectModified(UObject* Object)
+{
+    // Struct and enum editors call Modify on the type before changing it
+    if (Object && (Object->IsA<UScriptStruct>() || Object->IsA<UEnum>()))
+    {
+        const FObjectKey Key(Object);
+        if (Structs.Remove(Key) > 0 || Enums.Remove(Key) > 0)
+        {
+            FN2CLogger::Get().Log(FString::Printf(TEXT("Type cache: invalidated %s after modification"),
+                *Object->GetName()), EN2CLogSeverity::Debug);
+        }
+    }
+}
+
+void FN2CTypeCache::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+    InvalidatePackage(Package);
+}
+
+void FN2CTypeCache::HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event)
+{
+    // Drop the old package's types before its objects are replaced
+    if (Phase == EPackageReloadPhase::PrePackageFixup && Event)
+    {
+        InvalidatePackage(Event->GetOldPackage());
+    }
+}
@@ -160,3 +160,42 @@ FN2CGeminiPricing FN2CLLMModelUtils::GetGeminiPricing(EN2CGeminiModel Model)
     }
     return FN2CGeminiPricing();
 }
+
+int32 FN2CLLMModelUtils::GetContextWindow(EN2COpenAIModel Model)
+{
+    switch (Model)
+    {
+        case EN2COpenAIModel::GPT_4_1:
+            return 1047576;
+        case EN2COpenAIModel::GPT_o4_mini:
+        case EN2COpenAIModel::GPT_o3:
+        case EN2COpenAIModel::GPT_o3_mini:
+        case EN2COpenAIModel::GPT_o1:
+            return 200000;
+        default:
+            return 128000;
+    }
+}
+
+int32 FN2CLLMModelUtils::GetContextWindow(EN2CAnthropicModel Model)
+{
+    // All supported Claude models share the same context window
+    return 200000;
+}
+
+int32 FN2CLLMModelUtils::GetContextWindow(EN2CGeminiModel Model)
+{
+    switch (Model)
+    {
+        case EN2CGeminiModel::Gemini_1_5_Pro:
+        case EN2CGeminiModel::Gemini_2_0_ProExp_02_05:
+            return 2097152;
+        default:
+            return 1048576;
+    }
+}
+
+int32 FN2CLLMModelUtils::GetContextWindow(EN2CDeepSeekModel Model)
+{
+    return 65536;
+}
@@ -2,7 +2,6 @@
 
 #include "LLM/N2CLLMModule.h"
 
-#include "Core/N2CNodeTranslator.h"
 #include "Core/N2CSerializer.h"
 #include "Core/N2CSettings.h"
 #include "LLM/N2CSystemPromptManager.h"
@@ -65,6 +64,7 @@ bool UN2CLLMModule::Initialize()
 
 void UN2CLLMModule::ProcessN2CJson(
     const FString& JsonInput,
+    const FN2CBlueprint& SourceBlueprint,
     const FOnLLMResponseReceived& OnComplete)
 {
     if (!bIsInitialized)
@@ -76,6 +76,7 @@ void UN2CLLMModule::ProcessN2CJson(
     }
 
     CurrentStatus = EN2CSystemStatus::Processing;
+    RequestBlueprint = SourceBlueprint;
     
     // Broadcast that request is being sent
     OnTranslationRequestSent.Broadcast();
@@ -132,8 +133,7 @@ void UN2CLLMModule::ProcessN2CJson(
                         CurrentStatus = EN2CSystemStatus::Idle;
                             
                         // Save translation to disk
-                        const FN2CBlueprint& Blueprint = FN2CNodeTranslator::Get().GetN2CBlueprint();
-                        if (SaveTranslationToDisk(TranslationResponse, Blueprint))
+                        if (SaveTranslationToDisk(TranslationResponse, RequestBlueprint))
                         {
                             FN2CLogger::Get().Log(TEXT("Successfully saved translation to disk"), EN2CLogSeverity::Info);
                         }
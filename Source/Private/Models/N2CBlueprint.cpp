@@ -11,6 +11,57 @@ bool FN2CGraph::IsValid() const
     return Validator.ValidateGraph(*this, ErrorMessage);
 }
 
+FN2CDataFlowIndex::FN2CDataFlowIndex(const FN2CGraph& Graph)
+{
+    const int32 NumNodes = Graph.Nodes.Num();
+
+    PinOffsets.SetNumUninitialized(NumNodes + 1);
+    int32 NumRows = 0;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        PinOffsets[NodeIndex] = NumRows;
+        NumRows += Graph.Nodes[NodeIndex].NumPins();
+    }
+    PinOffsets[NumNodes] = NumRows;
+
+    auto GetRow = [this, &Graph](const FN2CDataEdge& Edge)
+    {
+        return Graph.Nodes.IsValidIndex(Edge.SourceNode) && Edge.SourcePin >= 0
+            && Edge.SourcePin < Graph.Nodes[Edge.SourceNode].NumPins()
+            ? PinOffsets[Edge.SourceNode] + Edge.SourcePin : INDEX_NONE;
+    };
+
+    // Count the targets of every row, then turn the counts into offsets
+    RowOffsets.SetNumZeroed(NumRows + 1);
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        const int32 Row = GetRow(Edge);
+        if (Row != INDEX_NONE)
+        {
+            ++RowOffsets[Row + 1];
+        }
+    }
+
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        RowOffsets[Row + 1] += RowOffsets[Row];
+    }
+
+    // Place every target after those of earlier edges with the same source
+    TArray<int32> NextTarget(RowOffsets.GetData(), NumRows);
+    Targets.SetNumUninitialized(RowOffsets[NumRows]);
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        const int32 Row = GetRow(Edge);
+        if (Row != INDEX_NONE)
+        {
+            FTarget& Target = Targets[NextTarget[Row]++];
+            Target.Node = Edge.TargetNode;
+            Target.Pin = Edge.TargetPin;
+        }
+    }
+}
+
 bool FN2CBlueprint::IsValid() const
 {
     // Use the validator to check the blueprint
@@ -6,8 +6,13 @@
 
 #include "HttpModule.h"
 #include "Models/N2CLogging.h"
+#include "Core/N2CBlueprintIndex.h"
 #include "Core/N2CEditorIntegration.h"
+#include "Core/N2CGraphCache.h"
+#include "Core/N2CNodeCache.h"
 #include "Core/N2CSettings.h"
+#include "Core/N2CSpeculativeTranslation.h"
+#include "Core/N2CTypeCache.h"
 #include "Code Editor/Models/N2CCodeEditorStyle.h"
 #include "Code Editor/Syntax/N2CSyntaxDefinitionFactory.h"
 #include "Code Editor/Widgets/N2CCodeEditorWidgetFactory.h"
@@ -67,6 +72,22 @@ void FNodeToCodeModule::StartupModule()
     // Initialize editor integration
     FN2CEditorIntegration::Get().Initialize();
     FN2CLogger::Get().Log(TEXT("Editor integration initialized"), EN2CLogSeverity::Debug);
+
+    // Initialize node cache change tracking
+    FN2CNodeCache::Get().Initialize();
+    FN2CLogger::Get().Log(TEXT("Node cache initialized"), EN2CLogSeverity::Debug);
+
+    // Initialize struct and enum cache invalidation
+    FN2CTypeCache::Get().Initialize();
+
+    // Track package changes for the dependency graph cache
+    FN2CGraphCache::Get().Initialize();
+
+    // Load the Blueprint index and keep it up to date, if enabled
+    FN2CBlueprintIndex::Get().Initialize();
+
+    // Discard background translations when their Blueprint is edited
+    FN2CSpeculativeTranslation::Get().Initialize();
     
     // Register widget factory
     FN2CCodeEditorWidgetFactory::Register();
@@ -96,8 +117,15 @@ void FNodeToCodeModule::ShutdownModule()
     UToolMenus::UnRegisterStartupCallback(this);
     UToolMenus::UnregisterOwner(this);
 
-    // Shutdown editor integration
+    // Shutdown editor integration and background translations
     FN2CEditorIntegration::Get().Shutdown();
+    FN2CSpeculativeTranslation::Get().Shutdown();
+
+    // Stop tracking graph changes
+    FN2CNodeCache::Get().Shutdown();
+    FN2CTypeCache::Get().Shutdown();
+    FN2CGraphCache::Get().Shutdown();
+    FN2CBlueprintIndex::Get().Shutdown();
 
     // Unregister widget factory
     FN2CCodeEditorWidgetFactory::Unregister();
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/N2CTestGraphs.h"
+#include "Utils/N2CGraphPartitioner.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FN2CGraphPartitionerPureBridgeTest, "NodeToCode.GraphPartitioner.PureNodeJoinsChains",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FN2CGraphPartitionerPureBridgeTest::RunTest(const FString& Parameters)
+{
+    using namespace N2CTestGraphs;
+
+    // BeginPlay -> Spawn.Out -> Scale (pure) -> Print.In <- Tick, plus an unrelated Other -> Log chain
+    FN2CGraph Graph;
+    Graph.Name = TEXT("EventGraph");
+    const int32 BeginPlay = AddEvent(Graph, TEXT("BeginPlay"));
+    const int32 Spawn = AddCall(Graph, TEXT("Spawn"));
+    const int32 Tick = AddEvent(Graph, TEXT("Tick"));
+    const int32 Print = AddCall(Graph, TEXT("Print"));
+    const int32 Scale = AddPure(Graph, TEXT("Scale"));
+    const int32 Other = AddEvent(Graph, TEXT("Other"));
+    const int32 Log = AddCall(Graph, TEXT("Log"));
+
+    Graph.Flows.Execution.Add(FN2CExecEdge(BeginPlay, Spawn));
+    Graph.Flows.Execution.Add(FN2CExecEdge(Tick, Print));
+    Graph.Flows.Execution.Add(FN2CExecEdge(Other, Log));
+    Graph.Flows.Data.Add(FN2CDataEdge(Spawn, 3, Scale, 0));
+    Graph.Flows.Data.Add(FN2CDataEdge(Scale, 1, Print, 1));
+
+    TArray<FN2CGraph> Graphs;
+    if (!TestTrue(TEXT("Graph with two independent chains is split"), FN2CGraphPartitioner::Partition(Graph, Graphs)))
+    {
+        return false;
+    }
+
+    if (!TestEqual(TEXT("Chains joined through the pure node form one graph"), Graphs.Num(), 2))
+    {
+        return false;
+    }
+
+    const FN2CGraph& Joined = Graphs[0];
+    TestEqual(TEXT("Joined graph name"), Joined.Name, FString(TEXT("EventGraph: BeginPlay")));
+    TestEqual(TEXT("Joined graph keeps both chains and the pure node"), Joined.Nodes.Num(), 5);
+    TestEqual(TEXT("Joined graph keeps both exec edges"), Joined.Flows.Execution.Num(), 2);
+    TestEqual(TEXT("Joined graph keeps the producer edge into the pure node"), Joined.Flows.Data.Num(), 2);
+
+    const FN2CGraph& Separate = Graphs[1];
+    TestEqual(TEXT("Unrelated chain name"), Separate.Name, FString(TEXT("EventGraph: Other")));
+    TestEqual(TEXT("Unrelated chain nodes"), Separate.Nodes.Num(), 2);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
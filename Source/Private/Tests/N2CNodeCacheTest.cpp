@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CNodeCache.h"
+#include "Core/N2CNodeTranslator.h"
+#include "Core/N2CSettings.h"
+#include "Core/N2CTranslationSession.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Tests/N2CTestGraphs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Result of one whole-Blueprint translation */
+    struct FN2CCacheRun
+    {
+        bool bSucceeded = false;
+        double Milliseconds = 0.0;
+        int32 Hits = 0;
+        int32 Misses = 0;
+    };
+
+    FN2CCacheRun TranslateBlueprint(UBlueprint* Blueprint)
+    {
+        FN2CCacheRun Run;
+        FN2CTranslationSession Session;
+
+        const double StartTime = FPlatformTime::Seconds();
+        Run.bSucceeded = FN2CNodeTranslator::Get().GenerateN2CStructForBlueprint(Session, Blueprint);
+        Run.Milliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        Run.Hits = Session.GetNodeCacheHits();
+        Run.Misses = Session.GetNodeCacheMisses();
+        return Run;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FN2CNodeCacheReextractTest, "NodeToCode.NodeCache.ReextractAfterEdit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FN2CNodeCacheReextractTest::RunTest(const FString& Parameters)
+{
+    using namespace N2CTestGraphs;
+
+    constexpr int32 NumNodes = 2000;
+
+    UBlueprint* Blueprint = CreateTestBlueprint();
+    const TArray<UK2Node_CallFunction*> Calls = AddPrintChain(Blueprint, NumNodes);
+    if (!TestEqual(TEXT("Print chain length"), Calls.Num(), NumNodes))
+    {
+        return false;
+    }
+
+    // The setting is global, so leave it as the editor had it
+    UN2CSettings* Settings = GetMutableDefault<UN2CSettings>();
+    const bool bPreviousEnableNodeCache = Settings->bEnableNodeCache;
+    ON_SCOPE_EXIT
+    {
+        Settings->bEnableNodeCache = bPreviousEnableNodeCache;
+        FN2CNodeCache::Get().InvalidateBlueprint(Blueprint);
+    };
+
+    UK2Node_CallFunction* EditedNode = Calls[NumNodes / 2];
+    UEdGraphPin* StringPin = EditedNode->FindPin(TEXT("InString"));
+    if (!TestNotNull(TEXT("Print String has an InString pin"), StringPin))
+    {
+        return false;
+    }
+
+    // Edits one node in the middle of the chain the way the details panel does
+    int32 EditCount = 0;
+    auto EditOneNode = [EditedNode, StringPin, &EditCount]()
+    {
+        EditedNode->Modify();
+        GetDefault<UEdGraphSchema_K2>()->TrySetDefaultValue(*StringPin, FString::Printf(TEXT("Edit %d"), ++EditCount));
+    };
+
+    // Cache on: a cold run fills the cache, a warm run shows what is never cached, the edit re-extracts a few nodes
+    Settings->bEnableNodeCache = true;
+    FN2CNodeCache::Get().InvalidateBlueprint(Blueprint);
+
+    const FN2CCacheRun Cold = TranslateBlueprint(Blueprint);
+    const FN2CCacheRun Warm = TranslateBlueprint(Blueprint);
+    EditOneNode();
+    const FN2CCacheRun CachedEdit = TranslateBlueprint(Blueprint);
+
+    // Cache off: every run extracts every node
+    Settings->bEnableNodeCache = false;
+    EditOneNode();
+    const FN2CCacheRun UncachedEdit = TranslateBlueprint(Blueprint);
+
+    AddInfo(FString::Printf(TEXT("Cold run: %.2f ms, %d hits, %d misses"), Cold.Milliseconds, Cold.Hits, Cold.Misses));
+    AddInfo(FString::Printf(TEXT("Warm run: %.2f ms, %d hits, %d misses"), Warm.Milliseconds, Warm.Hits, Warm.Misses));
+    AddInfo(FString::Printf(TEXT("Edit with node cache: %.2f ms, %d hits, %d misses"),
+        CachedEdit.Milliseconds, CachedEdit.Hits, CachedEdit.Misses));
+    AddInfo(FString::Printf(TEXT("Edit without node cache: %.2f ms, %d hits, %d misses"),
+        UncachedEdit.Milliseconds, UncachedEdit.Hits, UncachedEdit.Misses));
+
+    TestTrue(TEXT("All translations succeed"),
+        Cold.bSucceeded && Warm.bSucceeded && CachedEdit.bSucceeded && UncachedEdit.bSucceeded);
+    TestTrue(TEXT("Cold run extracts the whole chain"), Cold.Misses >= NumNodes);
+    TestTrue(TEXT("Warm run reuses the whole chain"), Warm.Hits >= NumNodes);
+
+    // The edited node and its two exec neighbours are dropped from the cache
+    TestTrue(TEXT("Edit re-extracts only the edited node and its neighbours"), CachedEdit.Misses <= Warm.Misses + 3);
+    TestEqual(TEXT("Edit keeps the rest of the chain cached"), CachedEdit.Hits + CachedEdit.Misses, Cold.Misses);
+
+    TestEqual(TEXT("Disabled cache is not read"), UncachedEdit.Hits, 0);
+    TestEqual(TEXT("Disabled cache extracts every node"), UncachedEdit.Misses, Cold.Misses);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
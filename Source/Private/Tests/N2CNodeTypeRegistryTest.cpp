@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/N2CNodeTypeRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/N2CTestGraphs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FN2CNodeTypeRegistryLookupTest, "NodeToCode.NodeTypeRegistry.CachedLookups",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FN2CNodeTypeRegistryLookupTest::RunTest(const FString& Parameters)
+{
+    using namespace N2CTestGraphs;
+
+    constexpr int32 NumPasses = 1000;
+
+    FN2CNodeTypeRegistry& Registry = FN2CNodeTypeRegistry::Get();
+
+    TArray<const UClass*> Classes;
+    Registry.GetMappedClasses(Classes);
+
+    // Nodes live in a Blueprint graph so variable nodes can look up their Blueprint
+    UBlueprint* Blueprint = CreateTestBlueprint();
+    UEdGraph* Graph = Blueprint ? FBlueprintEditorUtils::FindEventGraph(Blueprint) : nullptr;
+    if (!TestNotNull(TEXT("Test Blueprint has an event graph"), Graph))
+    {
+        return false;
+    }
+
+    TArray<const UK2Node*> Nodes;
+    for (const UClass* Class : Classes)
+    {
+        if (!Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+        {
+            Nodes.Add(NewObject<UK2Node>(Graph, const_cast<UClass*>(Class), NAME_None, RF_Transient));
+        }
+    }
+
+    if (!TestTrue(TEXT("Mapped node classes can be instantiated"), Nodes.Num() > 0))
+    {
+        return false;
+    }
+
+    // Cold: every lookup resolves its class again
+    TArray<EN2CNodeType> ColdTypes;
+    ColdTypes.SetNumUninitialized(Nodes.Num());
+
+    const double ColdStart = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            Registry.ResetClassTypeCache();
+            ColdTypes[NodeIndex] = Registry.GetNodeType(Nodes[NodeIndex]);
+        }
+    }
+    const double ColdSeconds = FPlatformTime::Seconds() - ColdStart;
+
+    // Cached: the first pass fills the cache, the rest only read it
+    TArray<EN2CNodeType> CachedTypes;
+    CachedTypes.SetNumUninitialized(Nodes.Num());
+
+    const double CachedStart = FPlatformTime::Seconds();
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            CachedTypes[NodeIndex] = Registry.GetNodeType(Nodes[NodeIndex]);
+        }
+    }
+    const double CachedSeconds = FPlatformTime::Seconds() - CachedStart;
+
+    const double NumLookups = static_cast<double>(NumPasses) * Nodes.Num();
+    AddInfo(FString::Printf(TEXT("%d mapped classes, %d instantiated, %d lookups per run"),
+        Classes.Num(), Nodes.Num(), NumPasses * Nodes.Num()));
+    AddInfo(FString::Printf(TEXT("Cold ResolveClassType: %.1f ns per lookup"), ColdSeconds * 1.0e9 / NumLookups));
+    AddInfo(FString::Printf(TEXT("Cached lookup: %.1f ns per lookup (%.1fx faster)"),
+        CachedSeconds * 1.0e9 / NumLookups, ColdSeconds / FMath::Max(CachedSeconds, UE_SMALL_NUMBER)));
+
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        TestEqual(FString::Printf(TEXT("Cached type of %s matches the cold type"), *Nodes[NodeIndex]->GetClass()->GetName()),
+            static_cast<int32>(CachedTypes[NodeIndex]), static_cast<int32>(ColdTypes[NodeIndex]));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
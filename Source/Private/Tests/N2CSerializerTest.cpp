@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CSerializer.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Tests/N2CTestGraphs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FN2CSerializerFanOutTest, "NodeToCode.Serializer.DataFlowFanOutRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FN2CSerializerFanOutTest::RunTest(const FString& Parameters)
+{
+    using namespace N2CTestGraphs;
+
+    // Speed.Value feeds Abs, Sqrt and Negate; Abs.Out feeds Clamp
+    FN2CBlueprint Blueprint;
+    Blueprint.Metadata.Name = TEXT("BP_FanOut");
+
+    FN2CGraph& Graph = Blueprint.Graphs.AddDefaulted_GetRef();
+    Graph.Name = TEXT("ComputeSpeed");
+
+    FN2CNodeDefinition& Speed = Graph.Nodes.AddDefaulted_GetRef();
+    Speed.NodeType = EN2CNodeType::VariableGet;
+    Speed.Name = TEXT("Speed");
+    Speed.bPure = true;
+    Speed.OutputPins.Add(MakePin(TEXT("Value")));
+
+    const int32 Abs = AddPure(Graph, TEXT("Abs"));
+    const int32 Sqrt = AddPure(Graph, TEXT("Sqrt"));
+    const int32 Negate = AddPure(Graph, TEXT("Negate"));
+    const int32 Clamp = AddPure(Graph, TEXT("Clamp"));
+
+    Graph.Flows.Data.Add(FN2CDataEdge(0, 0, Abs, 0));
+    Graph.Flows.Data.Add(FN2CDataEdge(0, 0, Sqrt, 0));
+    Graph.Flows.Data.Add(FN2CDataEdge(0, 0, Negate, 0));
+    Graph.Flows.Data.Add(FN2CDataEdge(Abs, 1, Clamp, 0));
+
+    // The formatting is global, so leave it as the editor had it
+    const bool bPreviousPrettyPrint = FN2CSerializer::IsPrettyPrint();
+    ON_SCOPE_EXIT
+    {
+        FN2CSerializer::SetPrettyPrint(bPreviousPrettyPrint);
+    };
+
+    FN2CSerializer::SetPrettyPrint(false);
+    const FString Json = FN2CSerializer::ToJson(Blueprint);
+
+    FN2CBlueprint Parsed;
+    if (!TestTrue(TEXT("Serialized Blueprint parses"), FN2CSerializer::FromJson(Json, Parsed)))
+    {
+        return false;
+    }
+
+    if (!TestEqual(TEXT("Graph count"), Parsed.Graphs.Num(), 1))
+    {
+        return false;
+    }
+
+    const FN2CGraph& ParsedGraph = Parsed.Graphs[0];
+    TestEqual(TEXT("Node count"), ParsedGraph.Nodes.Num(), Graph.Nodes.Num());
+    TestEqual(TEXT("Data edge count"), ParsedGraph.Flows.Data.Num(), Graph.Flows.Data.Num());
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        TestTrue(FString::Printf(TEXT("Edge N%d.P%d -> N%d.P%d survives"),
+            Edge.SourceNode + 1, Edge.SourcePin + 1, Edge.TargetNode + 1, Edge.TargetPin + 1),
+            ParsedGraph.Flows.Data.Contains(Edge));
+    }
+
+    // One row for Speed, two for every pure call; Speed.Value owns three targets and Abs.Out one
+    const FN2CDataFlowIndex DataFlows(ParsedGraph);
+    TestEqual(TEXT("Indexed edge count"), DataFlows.NumEdges(), 4);
+
+    const TArray<int32> ExpectedRowOffsets = { 0, 3, 3, 4, 4, 4, 4, 4, 4, 4 };
+    TestEqual(TEXT("Row offsets"), TArray<int32>(DataFlows.GetRowOffsets()), ExpectedRowOffsets);
+    TestEqual(TEXT("Row of Abs.Out"), DataFlows.GetRow(Abs, 1), 2);
+
+    const TArray<int32> ExpectedTargetNodes = { Abs, Sqrt, Negate, Clamp };
+    const TArrayView<const FN2CDataFlowIndex::FTarget> Targets = DataFlows.GetAllTargets();
+    if (TestEqual(TEXT("Target count"), Targets.Num(), ExpectedTargetNodes.Num()))
+    {
+        for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+        {
+            TestEqual(FString::Printf(TEXT("Target %d node"), TargetIndex), Targets[TargetIndex].Node, ExpectedTargetNodes[TargetIndex]);
+            TestEqual(FString::Printf(TEXT("Target %d pin"), TargetIndex), Targets[TargetIndex].Pin, 0);
+        }
+    }
+
+    TestEqual(TEXT("Speed.Value fans out to three inputs"), DataFlows.GetTargets(0, 0).Num(), 3);
+    TestEqual(TEXT("Abs.Out feeds one input"), DataFlows.GetTargets(Abs, 1).Num(), 1);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
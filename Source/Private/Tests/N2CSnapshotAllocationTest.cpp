@@ -0,0 +1,168 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Core/N2CNodeTranslator.h"
+#include "Core/N2CSettings.h"
+#include "Core/N2CTranslationSession.h"
+#include "Engine/Blueprint.h"
+#include "HAL/MallocBase.h"
+#include "K2Node_CallFunction.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "Tests/N2CTestGraphs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /**
+     * Forwards to the real allocator and counts the allocations made on one thread.
+     * Other threads keep allocating through it while it is installed, uncounted.
+     */
+    class FN2CCountingMalloc final : public FMalloc
+    {
+    public:
+        void Install()
+        {
+            ThreadId = FPlatformTLS::GetCurrentThreadId();
+            NumAllocations = 0;
+            Inner = GMalloc;
+            GMalloc = this;
+        }
+
+        void Uninstall()
+        {
+            GMalloc = Inner;
+        }
+
+        int64 GetNumAllocations() const { return NumAllocations; }
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            CountAllocation();
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            CountAllocation();
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("N2CCountingMalloc"); }
+
+    private:
+        void CountAllocation()
+        {
+            if (FPlatformTLS::GetCurrentThreadId() == ThreadId)
+            {
+                ++NumAllocations;
+            }
+        }
+
+        FMalloc* Inner = nullptr;
+        uint32 ThreadId = 0;
+        int64 NumAllocations = 0;
+    };
+
+    /** Allocations made while snapshotting a Blueprint */
+    struct FN2CSnapshotAllocations
+    {
+        int32 NumNodes = 0;
+        int32 NumPins = 0;
+        int64 NumAllocations = 0;
+
+        double PerNode() const { return NumNodes > 0 ? static_cast<double>(NumAllocations) / NumNodes : 0.0; }
+        double PerPin() const { return NumPins > 0 ? static_cast<double>(NumAllocations) / NumPins : 0.0; }
+    };
+
+    FN2CSnapshotAllocations CountSnapshotAllocations(UBlueprint* Blueprint)
+    {
+        // Installed for the lifetime of the editor, since other threads may still be inside it after uninstalling
+        static FN2CCountingMalloc CountingMalloc;
+
+        FN2CNodeTranslator& Translator = FN2CNodeTranslator::Get();
+        FN2CSnapshotAllocations Result;
+
+        // The first pass fills the name caches, which are shared with every later translation
+        for (int32 Pass = 0; Pass < 2; ++Pass)
+        {
+            FN2CTranslationSession Session;
+            if (!Translator.BeginBlueprintTranslation(Session, Blueprint))
+            {
+                return Result;
+            }
+
+            const bool bCount = Pass == 1;
+            if (bCount)
+            {
+                CountingMalloc.Install();
+            }
+
+            Translator.StepSnapshots(Session, TNumericLimits<double>::Max());
+
+            if (bCount)
+            {
+                CountingMalloc.Uninstall();
+                Result.NumNodes = Session.GetNumNodesSnapshotted();
+                Result.NumAllocations = CountingMalloc.GetNumAllocations();
+            }
+        }
+
+        for (const TObjectPtr<UEdGraph>& Graph : Blueprint->UbergraphPages)
+        {
+            for (const TObjectPtr<UEdGraphNode>& Node : Graph->Nodes)
+            {
+                Result.NumPins += Node ? Node->Pins.Num() : 0;
+            }
+        }
+
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FN2CSnapshotAllocationTest, "NodeToCode.NodeTranslator.SnapshotAllocations",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FN2CSnapshotAllocationTest::RunTest(const FString& Parameters)
+{
+    using namespace N2CTestGraphs;
+
+    // Every node is extracted, not reused from the node cache
+    UN2CSettings* Settings = GetMutableDefault<UN2CSettings>();
+    const bool bPreviousEnableNodeCache = Settings->bEnableNodeCache;
+    Settings->bEnableNodeCache = false;
+    ON_SCOPE_EXIT
+    {
+        Settings->bEnableNodeCache = bPreviousEnableNodeCache;
+    };
+
+    UBlueprint* SmallBlueprint = CreateTestBlueprint();
+    AddPrintChain(SmallBlueprint, 500);
+    UBlueprint* LargeBlueprint = CreateTestBlueprint();
+    AddPrintChain(LargeBlueprint, 5000);
+
+    const FN2CSnapshotAllocations Small = CountSnapshotAllocations(SmallBlueprint);
+    const FN2CSnapshotAllocations Large = CountSnapshotAllocations(LargeBlueprint);
+
+    AddInfo(FString::Printf(TEXT("%d nodes, %d pins: %lld allocations, %.2f per node, %.2f per pin"),
+        Small.NumNodes, Small.NumPins, Small.NumAllocations, Small.PerNode(), Small.PerPin()));
+    AddInfo(FString::Printf(TEXT("%d nodes, %d pins: %lld allocations, %.2f per node, %.2f per pin"),
+        Large.NumNodes, Large.NumPins, Large.NumAllocations, Large.PerNode(), Large.PerPin()));
+
+    if (!TestTrue(TEXT("Both chains are snapshotted"), Small.NumNodes >= 500 && Large.NumNodes >= 5000))
+    {
+        return false;
+    }
+
+    // Allocations that grow with the graph per node would show up as a higher rate on the larger graph
+    TestTrue(TEXT("Allocations per node do not grow with the graph"), Large.PerNode() <= Small.PerNode() * 1.1 + 1.0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Tests/N2CTestGraphs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+
+namespace N2CTestGraphs
+{
+    UBlueprint* CreateTestBlueprint()
+    {
+        const FName Name = MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_N2CTest"));
+        return FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), GetTransientPackage(), Name, BPTYPE_Normal,
+            UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+    }
+
+    TArray<UK2Node_CallFunction*> AddPrintChain(UBlueprint* Blueprint, int32 NumNodes)
+    {
+        TArray<UK2Node_CallFunction*> Calls;
+
+        UEdGraph* Graph = Blueprint ? FBlueprintEditorUtils::FindEventGraph(Blueprint) : nullptr;
+        if (!Graph)
+        {
+            return Calls;
+        }
+
+        FGraphNodeCreator<UK2Node_CustomEvent> EventCreator(*Graph);
+        UK2Node_CustomEvent* Event = EventCreator.CreateNode(false);
+        Event->CustomFunctionName = MakeUniqueObjectName(Graph, UK2Node_CustomEvent::StaticClass(), TEXT("N2CTestEvent"));
+        EventCreator.Finalize();
+
+        UFunction* PrintString = UKismetSystemLibrary::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+
+        UEdGraphPin* ThenPin = Event->FindPinChecked(UEdGraphSchema_K2::PN_Then);
+        Calls.Reserve(NumNodes);
+        for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+        {
+            FGraphNodeCreator<UK2Node_CallFunction> CallCreator(*Graph);
+            UK2Node_CallFunction* Call = CallCreator.CreateNode(false);
+            Call->SetFromFunction(PrintString);
+            Call->NodePosX = (NodeIndex + 1) * 300;
+            CallCreator.Finalize();
+
+            ThenPin->MakeLinkTo(Call->GetExecPin());
+            ThenPin = Call->GetThenPin();
+            Calls.Add(Call);
+        }
+
+        return Calls;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UBlueprint;
+class UK2Node_CallFunction;
+
+/** Graph-building helpers shared by the automation tests */
+namespace N2CTestGraphs
+{
+    /** Pin definition with a name and type */
+    inline FN2CPinDefinition MakePin(const TCHAR* Name, EN2CPinType Type = EN2CPinType::Float)
+    {
+        FN2CPinDefinition Pin;
+        Pin.Name = Name;
+        Pin.Type = Type;
+        return Pin;
+    }
+
+    /** Event with a single exec output */
+    inline int32 AddEvent(FN2CGraph& Graph, const TCHAR* Name)
+    {
+        FN2CNodeDefinition& Node = Graph.Nodes.AddDefaulted_GetRef();
+        Node.NodeType = EN2CNodeType::Event;
+        Node.Name = Name;
+        Node.OutputPins.Add(MakePin(TEXT("Then"), EN2CPinType::Exec));
+        return Graph.Nodes.Num() - 1;
+    }
+
+    /** Impure call with exec in and out, a float input at pin 1 and a float output at pin 3 */
+    inline int32 AddCall(FN2CGraph& Graph, const TCHAR* Name)
+    {
+        FN2CNodeDefinition& Node = Graph.Nodes.AddDefaulted_GetRef();
+        Node.NodeType = EN2CNodeType::CallFunction;
+        Node.Name = Name;
+        Node.InputPins.Add(MakePin(TEXT("Execute"), EN2CPinType::Exec));
+        Node.InputPins.Add(MakePin(TEXT("In")));
+        Node.OutputPins.Add(MakePin(TEXT("Then"), EN2CPinType::Exec));
+        Node.OutputPins.Add(MakePin(TEXT("Out")));
+        return Graph.Nodes.Num() - 1;
+    }
+
+    /** Pure call with a float input at pin 0 and a float output at pin 1 */
+    inline int32 AddPure(FN2CGraph& Graph, const TCHAR* Name)
+    {
+        FN2CNodeDefinition& Node = Graph.Nodes.AddDefaulted_GetRef();
+        Node.NodeType = EN2CNodeType::CallFunction;
+        Node.Name = Name;
+        Node.bPure = true;
+        Node.InputPins.Add(MakePin(TEXT("In")));
+        Node.OutputPins.Add(MakePin(TEXT("Out")));
+        return Graph.Nodes.Num() - 1;
+    }
+
+    /** Create a transient actor Blueprint that is collected with the next garbage collection */
+    UBlueprint* CreateTestBlueprint();
+
+    /**
+     * Add a custom event to a Blueprint's event graph that executes a chain of Print String calls
+     *
+     * @param Blueprint Blueprint created by CreateTestBlueprint
+     * @param NumNodes Number of Print String calls
+     * @return The calls in execution order
+     */
+    TArray<UK2Node_CallFunction*> AddPrintChain(UBlueprint* Blueprint, int32 NumNodes);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
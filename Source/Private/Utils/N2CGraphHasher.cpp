@@ -0,0 +1,296 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/N2CGraphHasher.h"
+
+#include "Hash/CityHash.h"
+
+namespace
+{
+    uint64 HashBytes(const void* Data, int32 Size, uint64 Seed)
+    {
+        return CityHash64WithSeed(static_cast<const char*>(Data), Size, Seed);
+    }
+
+    uint64 HashString(const FString& Value, uint64 Seed)
+    {
+        // Include the length so adjacent strings cannot trade characters
+        const int32 Length = Value.Len();
+        Seed = HashBytes(&Length, sizeof(Length), Seed);
+        return HashBytes(*Value, Value.Len() * sizeof(TCHAR), Seed);
+    }
+
+    uint64 HashInt(int32 Value, uint64 Seed)
+    {
+        return HashBytes(&Value, sizeof(Value), Seed);
+    }
+}
+
+uint64 FN2CGraphHasher::HashNodeContent(const FN2CNodeDefinition& Node)
+{
+    return HashNode(Node, 0);
+}
+
+uint64 FN2CGraphHasher::HashGraph(FN2CGraph& Graph)
+{
+    const int32 NumNodes = Graph.Nodes.Num();
+
+    // Source of every linked input pin, per node
+    TArray<TArray<const FN2CDataEdge*>> Inputs;
+    Inputs.SetNum(NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Inputs[NodeIndex].Init(nullptr, Graph.Nodes[NodeIndex].InputPins.Num());
+    }
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode) && Graph.Nodes.IsValidIndex(Edge.TargetNode)
+            && Inputs[Edge.TargetNode].IsValidIndex(Edge.TargetPin))
+        {
+            Inputs[Edge.TargetNode][Edge.TargetPin] = &Edge;
+        }
+    }
+
+    // Hash nodes after their inputs; an input that closes a cycle contributes only its source's content
+    enum class EState : uint8 { Pending, Visiting, Done };
+    TArray<EState> States;
+    States.Init(EState::Pending, NumNodes);
+
+    TArray<TPair<int32, int32>> Stack;
+    for (int32 StartIndex = 0; StartIndex < NumNodes; ++StartIndex)
+    {
+        if (States[StartIndex] != EState::Pending)
+        {
+            continue;
+        }
+
+        States[StartIndex] = EState::Visiting;
+        Stack.Add(TPair<int32, int32>(StartIndex, 0));
+
+        while (Stack.Num() > 0)
+        {
+            const int32 NodeIndex = Stack.Last().Key;
+            const int32 PinIndex = Stack.Last().Value++;
+            const TArray<const FN2CDataEdge*>& NodeInputs = Inputs[NodeIndex];
+
+            if (PinIndex < NodeInputs.Num())
+            {
+                const FN2CDataEdge* Edge = NodeInputs[PinIndex];
+                if (Edge && States[Edge->SourceNode] == EState::Pending)
+                {
+                    States[Edge->SourceNode] = EState::Visiting;
+                    Stack.Add(TPair<int32, int32>(Edge->SourceNode, 0));
+                }
+                continue;
+            }
+
+            FN2CNodeDefinition& Node = Graph.Nodes[NodeIndex];
+            uint64 Hash = HashNode(Node, 0);
+            for (int32 InputIndex = 0; InputIndex < NodeInputs.Num(); ++InputIndex)
+            {
+                if (const FN2CDataEdge* Edge = NodeInputs[InputIndex])
+                {
+                    const FN2CNodeDefinition& Source = Graph.Nodes[Edge->SourceNode];
+                    const uint64 SourceHash = States[Edge->SourceNode] == EState::Done ? Source.Hash : HashNode(Source, 0);
+                    Hash = HashInt(InputIndex, Hash);
+                    Hash = HashInt(Edge->SourcePin, Hash);
+                    Hash = HashBytes(&SourceHash, sizeof(SourceHash), Hash);
+                }
+            }
+
+            Node.Hash = Hash;
+            States[NodeIndex] = EState::Done;
+            Stack.Pop();
+        }
+    }
+
+    uint64 Hash = HashInt(static_cast<int32>(Graph.GraphType), 0);
+
+    Hash = HashInt(NumNodes, Hash);
+    for (const FN2CNodeDefinition& Node : Graph.Nodes)
+    {
+        Hash = HashBytes(&Node.Hash, sizeof(Node.Hash), Hash);
+    }
+
+    Hash = HashInt(Graph.Flows.Execution.Num(), Hash);
+    for (const FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        Hash = HashInt(Edge.SourceNode, Hash);
+        Hash = HashInt(Edge.TargetNode, Hash);
+    }
+
+    Hash = HashInt(Graph.Flows.Data.Num(), Hash);
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        Hash = HashInt(Edge.SourceNode, Hash);
+        Hash = HashInt(Edge.SourcePin, Hash);
+        Hash = HashInt(Edge.TargetNode, Hash);
+        Hash = HashInt(Edge.TargetPin, Hash);
+    }
+
+    Graph.BodyHash = Hash;
+    return Hash;
+}
+
+uint64 FN2CGraphHasher::HashBlueprint(FN2CBlueprint& Blueprint)
+{
+    uint64 Hash = HashString(Blueprint.Version.Value, 0);
+    Hash = HashString(Blueprint.Metadata.Name, Hash);
+    Hash = HashInt(static_cast<int32>(Blueprint.Metadata.BlueprintType), Hash);
+    Hash = HashString(Blueprint.Metadata.BlueprintClass, Hash);
+
+    Hash = HashInt(Blueprint.Graphs.Num(), Hash);
+    for (FN2CGraph& Graph : Blueprint.Graphs)
+    {
+        const uint64 GraphHash = HashGraph(Graph);
+        Hash = HashString(Graph.Name, Hash);
+        Hash = HashBytes(&GraphHash, sizeof(GraphHash), Hash);
+    }
+
+    Hash = HashInt(Blueprint.Structs.Num(), Hash);
+    for (const FN2CStruct& Struct : Blueprint.Structs)
+    {
+        Hash = HashStruct(Struct, Hash);
+    }
+
+    Hash = HashInt(Blueprint.Enums.Num(), Hash);
+    for (const FN2CEnum& Enum : Blueprint.Enums)
+    {
+        Hash = HashEnum(Enum, Hash);
+    }
+
+    Blueprint.Hash = Hash;
+    return Hash;
+}
+
+bool FN2CGraphHasher::AreBodiesEqual(const FN2CGraph& A, const FN2CGraph& B)
+{
+    if (A.GraphType != B.GraphType || A.Nodes.Num() != B.Nodes.Num()
+        || A.Flows.Execution != B.Flows.Execution || A.Flows.Data != B.Flows.Data)
+    {
+        return false;
+    }
+
+    for (int32 NodeIndex = 0; NodeIndex < A.Nodes.Num(); ++NodeIndex)
+    {
+        if (!AreNodesEqual(A.Nodes[NodeIndex], B.Nodes[NodeIndex]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FString FN2CGraphHasher::HashToString(uint64 Hash)
+{
+    return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+uint64 FN2CGraphHasher::HashFromString(const FString& HashString)
+{
+    return HashString.Len() == 16 ? FParse::HexNumber64(*HashString) : 0;
+}
+
+uint64 FN2CGraphHasher::HashNode(const FN2CNodeDefinition& Node, uint64 Seed)
+{
+    uint64 Hash = HashInt(static_cast<int32>(Node.NodeType), Seed);
+    Hash = HashString(Node.Name, Hash);
+    Hash = HashString(Node.MemberParent, Hash);
+    Hash = HashString(Node.MemberName, Hash);
+    Hash = HashString(Node.Comment, Hash);
+    Hash = HashInt(Node.bPure | (Node.bLatent << 1), Hash);
+
+    Hash = HashInt(Node.InputPins.Num(), Hash);
+    for (const FN2CPinDefinition& Pin : Node.InputPins)
+    {
+        Hash = HashPin(Pin, Hash);
+    }
+
+    Hash = HashInt(Node.OutputPins.Num(), Hash);
+    for (const FN2CPinDefinition& Pin : Node.OutputPins)
+    {
+        Hash = HashPin(Pin, Hash);
+    }
+
+    return Hash;
+}
+
+uint64 FN2CGraphHasher::HashPin(const FN2CPinDefinition& Pin, uint64 Seed)
+{
+    uint64 Hash = HashInt(static_cast<int32>(Pin.Type), Seed);
+    Hash = HashString(Pin.Name, Hash);
+    Hash = HashString(Pin.SubType, Hash);
+    Hash = HashString(Pin.DefaultValue, Hash);
+    return HashInt(Pin.bConnected | (Pin.bIsReference << 1) | (Pin.bIsConst << 2)
+        | (Pin.bIsArray << 3) | (Pin.bIsMap << 4) | (Pin.bIsSet << 5), Hash);
+}
+
+uint64 FN2CGraphHasher::HashStruct(const FN2CStruct& Struct, uint64 Seed)
+{
+    uint64 Hash = HashString(Struct.Name, Seed);
+    Hash = HashString(Struct.Comment, Hash);
+
+    Hash = HashInt(Struct.Members.Num(), Hash);
+    for (const FN2CStructMember& Member : Struct.Members)
+    {
+        Hash = HashString(Member.Name, Hash);
+        Hash = HashInt(static_cast<int32>(Member.Type), Hash);
+        Hash = HashString(Member.TypeName, Hash);
+        Hash = HashInt(Member.bIsArray | (Member.bIsSet << 1) | (Member.bIsMap << 2), Hash);
+        Hash = HashInt(static_cast<int32>(Member.KeyType), Hash);
+        Hash = HashString(Member.KeyTypeName, Hash);
+        Hash = HashString(Member.DefaultValue, Hash);
+        Hash = HashString(Member.Comment, Hash);
+    }
+
+    return Hash;
+}
+
+uint64 FN2CGraphHasher::HashEnum(const FN2CEnum& Enum, uint64 Seed)
+{
+    uint64 Hash = HashString(Enum.Name, Seed);
+    Hash = HashString(Enum.Comment, Hash);
+
+    Hash = HashInt(Enum.Values.Num(), Hash);
+    for (const FN2CEnumValue& Value : Enum.Values)
+    {
+        Hash = HashString(Value.Name, Hash);
+        Hash = HashString(Value.Comment, Hash);
+    }
+
+    return Hash;
+}
+
+bool FN2CGraphHasher::AreNodesEqual(const FN2CNodeDefinition& A, const FN2CNodeDefinition& B)
+{
+    if (A.NodeType != B.NodeType || A.bPure != B.bPure || A.bLatent != B.bLatent
+        || A.InputPins.Num() != B.InputPins.Num() || A.OutputPins.Num() != B.OutputPins.Num()
+        || !A.Name.Equals(B.Name, ESearchCase::CaseSensitive)
+        || !A.MemberParent.Equals(B.MemberParent, ESearchCase::CaseSensitive)
+        || !A.MemberName.Equals(B.MemberName, ESearchCase::CaseSensitive)
+        || !A.Comment.Equals(B.Comment, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+
+    for (int32 PinIndex = 0; PinIndex < A.NumPins(); ++PinIndex)
+    {
+        if (!ArePinsEqual(A.GetPin(PinIndex), B.GetPin(PinIndex)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FN2CGraphHasher::ArePinsEqual(const FN2CPinDefinition& A, const FN2CPinDefinition& B)
+{
+    // Hashes are case sensitive, so comparisons must be too
+    return A.Type == B.Type
+        && A.Name.Equals(B.Name, ESearchCase::CaseSensitive)
+        && A.SubType.Equals(B.SubType, ESearchCase::CaseSensitive)
+        && A.DefaultValue.Equals(B.DefaultValue, ESearchCase::CaseSensitive)
+        && A.bConnected == B.bConnected && A.bIsReference == B.bIsReference && A.bIsConst == B.bIsConst
+        && A.bIsArray == B.bIsArray && A.bIsMap == B.bIsMap && A.bIsSet == B.bIsSet;
+}
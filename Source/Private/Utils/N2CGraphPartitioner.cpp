@@ -0,0 +1,286 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/N2CGraphPartitioner.h"
+
+#include "Utils/Passes/N2CDeadNodePass.h"
+
+namespace N2CGraphPartitioner
+{
+    int32 FindRoot(TArray<int32>& Parents, int32 Index)
+    {
+        while (Parents[Index] != Index)
+        {
+            Parents[Index] = Parents[Parents[Index]];
+            Index = Parents[Index];
+        }
+        return Index;
+    }
+
+    void Union(TArray<int32>& Parents, int32 A, int32 B)
+    {
+        A = FindRoot(Parents, A);
+        B = FindRoot(Parents, B);
+        if (A != B)
+        {
+            // The lower index wins so chains are numbered in node order
+            Parents[FMath::Max(A, B)] = FMath::Min(A, B);
+        }
+    }
+
+    /**
+     * Find a chain node a pure node reads, directly or through other pure nodes.
+     * All chains it reads are joined, since every reader of the pure node reads them all.
+     */
+    int32 FindUpstreamChain(int32 NodeIndex, const TArray<TArray<int32>>& DataSources, const TBitArray<>& InChain,
+        TArray<int32>& Parents, TArray<int32>& Upstream, TBitArray<>& Visited)
+    {
+        if (Visited[NodeIndex])
+        {
+            return Upstream[NodeIndex];
+        }
+        Visited[NodeIndex] = true;
+
+        int32 Result = INDEX_NONE;
+        for (int32 Source : DataSources[NodeIndex])
+        {
+            const int32 SourceChain = InChain[Source]
+                ? Source
+                : FindUpstreamChain(Source, DataSources, InChain, Parents, Upstream, Visited);
+            if (SourceChain == INDEX_NONE)
+            {
+                continue;
+            }
+
+            if (Result == INDEX_NONE)
+            {
+                Result = SourceChain;
+            }
+            else
+            {
+                Union(Parents, Result, SourceChain);
+            }
+        }
+
+        Upstream[NodeIndex] = Result;
+        return Result;
+    }
+}
+
+bool FN2CGraphPartitioner::Partition(const FN2CGraph& Graph, TArray<FN2CGraph>& OutGraphs)
+{
+    using namespace N2CGraphPartitioner;
+
+    const int32 NumNodes = Graph.Nodes.Num();
+    if (NumNodes == 0)
+    {
+        return false;
+    }
+
+    // Nodes that take part in execution belong to exactly one chain; all others can be shared
+    TBitArray<> InChain(false, NumNodes);
+    TArray<int32> Parents;
+    Parents.SetNumUninitialized(NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Parents[NodeIndex] = NodeIndex;
+        InChain[NodeIndex] = FN2CDeadNodePass::IsExecRoot(Graph.Nodes[NodeIndex]);
+    }
+
+    for (const FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode) && Graph.Nodes.IsValidIndex(Edge.TargetNode))
+        {
+            InChain[Edge.SourceNode] = true;
+            InChain[Edge.TargetNode] = true;
+            Union(Parents, Edge.SourceNode, Edge.TargetNode);
+        }
+    }
+
+    // Producers of each node's inputs; data passed between chains joins them
+    TArray<TArray<int32>> DataSources;
+    DataSources.SetNum(NumNodes);
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode) && Graph.Nodes.IsValidIndex(Edge.TargetNode))
+        {
+            DataSources[Edge.TargetNode].Add(Edge.SourceNode);
+            if (InChain[Edge.SourceNode] && InChain[Edge.TargetNode])
+            {
+                Union(Parents, Edge.SourceNode, Edge.TargetNode);
+            }
+        }
+    }
+
+    // Data a chain reads through pure nodes joins it to the chain that produced it
+    TArray<int32> Upstream;
+    Upstream.Init(INDEX_NONE, NumNodes);
+    TBitArray<> Visited(false, NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (!InChain[NodeIndex])
+        {
+            continue;
+        }
+
+        for (int32 Source : DataSources[NodeIndex])
+        {
+            if (!InChain[Source])
+            {
+                const int32 SourceChain = FindUpstreamChain(Source, DataSources, InChain, Parents, Upstream, Visited);
+                if (SourceChain != INDEX_NONE)
+                {
+                    Union(Parents, NodeIndex, SourceChain);
+                }
+            }
+        }
+    }
+
+    // Chains that start at an event, keyed by their lowest node, with the first event as their name
+    TMap<int32, int32> ChainEvents;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (InChain[NodeIndex] && FN2CDeadNodePass::IsExecRoot(Graph.Nodes[NodeIndex]))
+        {
+            const int32 Chain = FindRoot(Parents, NodeIndex);
+            if (!ChainEvents.Contains(Chain))
+            {
+                ChainEvents.Add(Chain, NodeIndex);
+            }
+        }
+    }
+
+    if (ChainEvents.Num() < 2)
+    {
+        return false;
+    }
+
+    ChainEvents.KeySort(TLess<int32>());
+
+    // Nodes of every chain that becomes a graph, in node order
+    TMap<int32, TArray<int32>> ChainNodes;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (InChain[NodeIndex])
+        {
+            const int32 Chain = FindRoot(Parents, NodeIndex);
+            if (ChainEvents.Contains(Chain))
+            {
+                ChainNodes.FindOrAdd(Chain).Add(NodeIndex);
+            }
+        }
+    }
+
+    TBitArray<> Claimed(false, NumNodes);
+    TBitArray<> Selected;
+    TArray<int32> Stack;
+    TSet<FString> UsedNames;
+    UsedNames.Add(Graph.Name);
+
+    OutGraphs.Reset();
+    for (const TPair<int32, int32>& ChainEvent : ChainEvents)
+    {
+        Selected.Init(false, NumNodes);
+        Stack.Reset();
+        for (int32 NodeIndex : ChainNodes.FindChecked(ChainEvent.Key))
+        {
+            Selected[NodeIndex] = true;
+            Stack.Add(NodeIndex);
+        }
+
+        // Pull in everything outside the chains that feeds it, transitively
+        while (Stack.Num() > 0)
+        {
+            const int32 NodeIndex = Stack.Pop();
+            for (int32 Source : DataSources[NodeIndex])
+            {
+                if (!Selected[Source] && !InChain[Source])
+                {
+                    Selected[Source] = true;
+                    Stack.Add(Source);
+                }
+            }
+        }
+
+        FN2CGraph& Unit = OutGraphs.AddDefaulted_GetRef();
+        ExtractNodes(Graph, Selected, Unit);
+
+        // Name the chain after its event, keeping names unique within the Blueprint's graph list
+        const FString BaseName = FString::Printf(TEXT("%s: %s"), *Graph.Name, *Graph.Nodes[ChainEvent.Value].Name);
+        Unit.Name = BaseName;
+        for (int32 Suffix = 2; UsedNames.Contains(Unit.Name); ++Suffix)
+        {
+            Unit.Name = FString::Printf(TEXT("%s (%d)"), *BaseName, Suffix);
+        }
+        UsedNames.Add(Unit.Name);
+
+        Claimed.CombineWithBitwiseOR(Selected, EBitwiseOperatorFlags::MaxSize);
+    }
+
+    // Orphaned chains and pure nodes no chain reads keep the original name
+    TBitArray<> Remaining(false, NumNodes);
+    bool bHasRemaining = false;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Remaining[NodeIndex] = !Claimed[NodeIndex];
+        bHasRemaining |= !Claimed[NodeIndex];
+    }
+
+    if (bHasRemaining)
+    {
+        FN2CGraph& Rest = OutGraphs.AddDefaulted_GetRef();
+        ExtractNodes(Graph, Remaining, Rest);
+        Rest.Name = Graph.Name;
+    }
+
+    return true;
+}
+
+void FN2CGraphPartitioner::ExtractNodes(const FN2CGraph& Graph, const TBitArray<>& Selected, FN2CGraph& OutGraph)
+{
+    OutGraph.GraphType = Graph.GraphType;
+
+    TArray<int32> Remap;
+    Remap.Init(INDEX_NONE, Graph.Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+    {
+        if (Selected[NodeIndex])
+        {
+            Remap[NodeIndex] = OutGraph.Nodes.Add(Graph.Nodes[NodeIndex]);
+        }
+    }
+
+    auto MapNode = [&Remap](int32 NodeIndex)
+    {
+        return Remap.IsValidIndex(NodeIndex) ? Remap[NodeIndex] : INDEX_NONE;
+    };
+
+    for (const FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        const int32 SourceNode = MapNode(Edge.SourceNode);
+        const int32 TargetNode = MapNode(Edge.TargetNode);
+        if (SourceNode != INDEX_NONE && TargetNode != INDEX_NONE)
+        {
+            OutGraph.Flows.Execution.Add(FN2CExecEdge(SourceNode, TargetNode));
+        }
+    }
+
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        const int32 SourceNode = MapNode(Edge.SourceNode);
+        const int32 TargetNode = MapNode(Edge.TargetNode);
+        if (SourceNode != INDEX_NONE && TargetNode != INDEX_NONE)
+        {
+            OutGraph.Flows.Data.Add(FN2CDataEdge(SourceNode, Edge.SourcePin, TargetNode, Edge.TargetPin));
+        }
+    }
+
+    for (const FN2CFoldedExpression& Folded : Graph.FoldedExpressions)
+    {
+        const int32 ExpressionNode = MapNode(Folded.ExpressionNode);
+        if (ExpressionNode != INDEX_NONE)
+        {
+            FN2CFoldedExpression& Copy = OutGraph.FoldedExpressions.Add_GetRef(Folded);
+            Copy.ExpressionNode = ExpressionNode;
+        }
+    }
+}
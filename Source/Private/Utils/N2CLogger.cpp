@@ -5,6 +5,7 @@
 #include "Misc/Paths.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/OutputDeviceConsole.h"
+#include "Misc/ScopeLock.h"
 
 FN2CLogger& FN2CLogger::Get()
 {
@@ -33,16 +34,20 @@ void FN2CLogger::Log(const FString& Message, EN2CLogSeverity Severity, const FSt
     Error.Context = Context;
     Error.Timestamp = FDateTime::Now();
 
-    // Add to collection
-    LoggedErrors.Add(Error);
-
     // Format for output
     FString FormattedMessage = FormatError(Error);
 
-    // Write to log file if enabled
-    if (bFileLoggingEnabled)
     {
-        WriteToFile(FormattedMessage);
+        FScopeLock Lock(&LogLock);
+
+        // Add to collection
+        LoggedErrors.Add(MoveTemp(Error));
+
+        // Write to log file if enabled
+        if (bFileLoggingEnabled)
+        {
+            WriteToFile(FormattedMessage);
+        }
     }
 
     // Output to console window
@@ -99,11 +104,13 @@ void FN2CLogger::LogWarning(const FString& Message, const FString& Context)
 
 TArray<FN2CError> FN2CLogger::GetErrors() const
 {
+    FScopeLock Lock(&LogLock);
     return LoggedErrors;
 }
 
 TArray<FN2CError> FN2CLogger::GetErrorsBySeverity(EN2CLogSeverity Severity) const
 {
+    FScopeLock Lock(&LogLock);
     TArray<FN2CError> FilteredErrors;
     for (const FN2CError& Error : LoggedErrors)
     {
@@ -117,6 +124,7 @@ TArray<FN2CError> FN2CLogger::GetErrorsBySeverity(EN2CLogSeverity Severity) cons
 
 void FN2CLogger::ClearErrors()
 {
+    FScopeLock Lock(&LogLock);
     LoggedErrors.Empty();
 }
 
@@ -2,6 +2,7 @@
 
 #include "Utils/N2CNodeTypeRegistry.h"
 #include "Utils/N2CLogger.h"
+#include "UObject/UObjectIterator.h"
 
 // Include all K2Node types
 #include "K2Node_ActorBoundEvent.h"
@@ -127,6 +128,7 @@ FN2CNodeTypeRegistry::FN2CNodeTypeRegistry()
 void FN2CNodeTypeRegistry::RegisterNodeType(const FName& ClassName, EN2CNodeType NodeType)
 {
     ClassNameMappings.Add(ClassName, NodeType);
+    ClassTypeCache.Reset();
 }
 
 void FN2CNodeTypeRegistry::RegisterNodeClass(const UClass* Class, EN2CNodeType NodeType)
@@ -134,6 +136,7 @@ void FN2CNodeTypeRegistry::RegisterNodeClass(const UClass* Class, EN2CNodeType N
     if (Class)
     {
         ClassMappings.Add(Class, NodeType);
+        ClassTypeCache.Reset();
     }
 }
 
@@ -143,44 +146,85 @@ EN2CNodeType FN2CNodeTypeRegistry::GetNodeType(const UK2Node* Node)
     {
         return EN2CNodeType::CallFunction; // Default
     }
+
+    // Resolve the class-determined part once per class
+    const UClass* NodeClass = Node->GetClass();
+    const FClassTypeInfo* ClassInfo = ClassTypeCache.Find(NodeClass);
+    if (!ClassInfo)
+    {
+        ClassInfo = &ClassTypeCache.Add(NodeClass, ResolveClassType(NodeClass));
+    }
+
+    // Variable node types depend on the referenced variable
+    if (ClassInfo->bIsVariableNode)
+    {
+        return DetermineVariableNodeType(CastChecked<UK2Node_Variable>(Node));
+    }
+
+    return ClassInfo->NodeType;
+}
+
+void FN2CNodeTypeRegistry::GetMappedClasses(TArray<const UClass*>& OutClasses) const
+{
+    for (const TPair<const UClass*, EN2CNodeType>& Mapping : ClassMappings)
+    {
+        OutClasses.AddUnique(Mapping.Key);
+    }
+
+    // Name mappings only match classes that are loaded
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        if (It->IsChildOf<UK2Node>() && ClassNameMappings.Contains(FName(*GetBaseNodeType(It->GetName()))))
+        {
+            OutClasses.AddUnique(*It);
+        }
+    }
+}
+
+FN2CNodeTypeRegistry::FClassTypeInfo FN2CNodeTypeRegistry::ResolveClassType(const UClass* Class) const
+{
+    FClassTypeInfo Info;
+    const FName ClassName = FName(*GetBaseNodeType(Class->GetName()));
     
     // Try setting make struct type first since MakeStruct is considered a variable
     // before being considered MakeStruct
-    if (const UK2Node_MakeStruct* MakeStructNode = Cast<UK2Node_MakeStruct>(Node))
+    if (Class->IsChildOf<UK2Node_MakeStruct>())
     {
-        FName ClassName = FName(*GetBaseNodeType(Node->GetClass()->GetName()));
-        if (ClassNameMappings.Contains(ClassName))
+        if (const EN2CNodeType* NodeType = ClassNameMappings.Find(ClassName))
         {
-            return ClassNameMappings[ClassName];
+            Info.NodeType = *NodeType;
+            return Info;
         }
     }
 
-    // Try setting variable type first
-    if (const UK2Node_Variable* VarNode = Cast<UK2Node_Variable>(Node))
+    // Variable nodes are resolved per node
+    if (Class->IsChildOf<UK2Node_Variable>())
     {
-        return DetermineVariableNodeType(VarNode);
+        Info.NodeType = EN2CNodeType::Variable;
+        Info.bIsVariableNode = true;
+        return Info;
     }
     
     // Try direct class mapping
-    if (ClassMappings.Contains(Node->GetClass()))
+    if (const EN2CNodeType* NodeType = ClassMappings.Find(Class))
     {
-        return ClassMappings[Node->GetClass()];
+        Info.NodeType = *NodeType;
+        return Info;
     }
     
     // Try class name mapping
-    FName ClassName = FName(*GetBaseNodeType(Node->GetClass()->GetName()));
-    if (ClassNameMappings.Contains(ClassName))
+    if (const EN2CNodeType* NodeType = ClassNameMappings.Find(ClassName))
     {
-        return ClassNameMappings[ClassName];
+        Info.NodeType = *NodeType;
+        return Info;
     }
     
     // Fall back to inheritance-based mapping
-    EN2CNodeType OutType = EN2CNodeType::CallFunction;
-    MapFromInheritance(Node, OutType);
-    return OutType;
+    MapFromInheritance(Class, Info.NodeType);
+    return Info;
 }
 
-FString FN2CNodeTypeRegistry::GetBaseNodeType(const FString& ClassName)
+FString FN2CNodeTypeRegistry::GetBaseNodeType(const FString& ClassName) const
 {
     static const FString Prefix = TEXT("K2Node_");
     if (ClassName.StartsWith(Prefix))
@@ -325,634 +369,635 @@ void FN2CNodeTypeRegistry::InitializeDefaultMappings()
     RegisterNodeClass(UK2Node_Variable::StaticClass(), EN2CNodeType::Variable);
 }
 
-bool FN2CNodeTypeRegistry::MapFromInheritance(const UK2Node* Node, EN2CNodeType& OutType)
+bool FN2CNodeTypeRegistry::MapFromInheritance(const UClass* Class, EN2CNodeType& OutType) const
 {
     // Handle common base classes
-    if (Node->IsA<UK2Node_CallFunction>())
+    if (Class->IsChildOf<UK2Node_CallFunction>())
     {
         OutType = EN2CNodeType::CallFunction;
         return true;
     }
     
-    if (Node->IsA<UK2Node_Event>())
+    if (Class->IsChildOf<UK2Node_Event>())
     {
         OutType = EN2CNodeType::Event;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MakeStruct>())
+    if (Class->IsChildOf<UK2Node_MakeStruct>())
     {
         OutType = EN2CNodeType::MakeStruct;
         return true;
     }
     
-    if (Node->IsA<UK2Node_Variable>())
+    if (Class->IsChildOf<UK2Node_Variable>())
     {
-        OutType = DetermineVariableNodeType(Cast<UK2Node_Variable>(Node));
+        // Refined per node by DetermineVariableNodeType
+        OutType = EN2CNodeType::Variable;
         return true;
     }
 
-    if (Node->IsA<UK2Node_VariableSetRef>())
+    if (Class->IsChildOf<UK2Node_VariableSetRef>())
     {
         OutType = EN2CNodeType::VariableSetRef;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ActorBoundEvent>())
+    if (Class->IsChildOf<UK2Node_ActorBoundEvent>())
     {
         OutType = EN2CNodeType::ActorBoundEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AddComponent>())
+    if (Class->IsChildOf<UK2Node_AddComponent>())
     {
         OutType = EN2CNodeType::AddComponent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AddComponentByClass>())
+    if (Class->IsChildOf<UK2Node_AddComponentByClass>())
     {
         OutType = EN2CNodeType::AddComponentByClass;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AddDelegate>())
+    if (Class->IsChildOf<UK2Node_AddDelegate>())
     {
         OutType = EN2CNodeType::AddDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AddPinInterface>())
+    if (Class->IsChildOf<UK2Node_AddPinInterface>())
     {
         OutType = EN2CNodeType::AddPinInterface;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AssignDelegate>())
+    if (Class->IsChildOf<UK2Node_AssignDelegate>())
     {
         OutType = EN2CNodeType::AssignDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AssignmentStatement>())
+    if (Class->IsChildOf<UK2Node_AssignmentStatement>())
     {
         OutType = EN2CNodeType::AssignmentStatement;
         return true;
     }
 
-    if (Node->IsA<UK2Node_AsyncAction>())
+    if (Class->IsChildOf<UK2Node_AsyncAction>())
     {
         OutType = EN2CNodeType::AsyncAction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_BaseAsyncTask>())
+    if (Class->IsChildOf<UK2Node_BaseAsyncTask>())
     {
         OutType = EN2CNodeType::BaseAsyncTask;
         return true;
     }
 
-    if (Node->IsA<UK2Node_BaseMCDelegate>())
+    if (Class->IsChildOf<UK2Node_BaseMCDelegate>())
     {
         OutType = EN2CNodeType::BaseMCDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_BitmaskLiteral>())
+    if (Class->IsChildOf<UK2Node_BitmaskLiteral>())
     {
         OutType = EN2CNodeType::BitmaskLiteral;
         return true;
     }
 
-    if (Node->IsA<UK2Node_BreakStruct>())
+    if (Class->IsChildOf<UK2Node_BreakStruct>())
     {
         OutType = EN2CNodeType::BreakStruct;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallArrayFunction>())
+    if (Class->IsChildOf<UK2Node_CallArrayFunction>())
     {
         OutType = EN2CNodeType::CallArrayFunction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallDataTableFunction>())
+    if (Class->IsChildOf<UK2Node_CallDataTableFunction>())
     {
         OutType = EN2CNodeType::CallDataTableFunction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallDelegate>())
+    if (Class->IsChildOf<UK2Node_CallDelegate>())
     {
         OutType = EN2CNodeType::CallDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallFunctionOnMember>())
+    if (Class->IsChildOf<UK2Node_CallFunctionOnMember>())
     {
         OutType = EN2CNodeType::CallFunctionOnMember;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallMaterialParameterCollectionFunction>())
+    if (Class->IsChildOf<UK2Node_CallMaterialParameterCollectionFunction>())
     {
         OutType = EN2CNodeType::CallMaterialParameterCollection;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CallParentFunction>())
+    if (Class->IsChildOf<UK2Node_CallParentFunction>())
     {
         OutType = EN2CNodeType::CallParentFunction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CastByteToEnum>())
+    if (Class->IsChildOf<UK2Node_CastByteToEnum>())
     {
         OutType = EN2CNodeType::CastByteToEnum;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ClassDynamicCast>())
+    if (Class->IsChildOf<UK2Node_ClassDynamicCast>())
     {
         OutType = EN2CNodeType::ClassDynamicCast;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ClearDelegate>())
+    if (Class->IsChildOf<UK2Node_ClearDelegate>())
     {
         OutType = EN2CNodeType::ClearDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CommutativeAssociativeBinaryOperator>())
+    if (Class->IsChildOf<UK2Node_CommutativeAssociativeBinaryOperator>())
     {
         OutType = EN2CNodeType::CommutativeAssociativeBinaryOperator;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ComponentBoundEvent>())
+    if (Class->IsChildOf<UK2Node_ComponentBoundEvent>())
     {
         OutType = EN2CNodeType::ComponentBoundEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Composite>())
+    if (Class->IsChildOf<UK2Node_Composite>())
     {
         OutType = EN2CNodeType::Composite;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ConstructObjectFromClass>())
+    if (Class->IsChildOf<UK2Node_ConstructObjectFromClass>())
     {
         OutType = EN2CNodeType::ConstructObjectFromClass;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ConvertAsset>())
+    if (Class->IsChildOf<UK2Node_ConvertAsset>())
     {
         OutType = EN2CNodeType::ConvertAsset;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Copy>())
+    if (Class->IsChildOf<UK2Node_Copy>())
     {
         OutType = EN2CNodeType::Copy;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CreateDelegate>())
+    if (Class->IsChildOf<UK2Node_CreateDelegate>())
     {
         OutType = EN2CNodeType::CreateDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_CustomEvent>())
+    if (Class->IsChildOf<UK2Node_CustomEvent>())
     {
         OutType = EN2CNodeType::CustomEvent;
         return true;
     }
     
-    if (Node->IsA<UK2Node_DeadClass>())
+    if (Class->IsChildOf<UK2Node_DeadClass>())
     {
         OutType = EN2CNodeType::DeadClass;
         return true;
     }
 
-    if (Node->IsA<UK2Node_DelegateSet>())
+    if (Class->IsChildOf<UK2Node_DelegateSet>())
     {
         OutType = EN2CNodeType::DelegateSet;
         return true;
     }
 
-    if (Node->IsA<UK2Node_DoOnceMultiInput>())
+    if (Class->IsChildOf<UK2Node_DoOnceMultiInput>())
     {
         OutType = EN2CNodeType::DoOnceMultiInput;
         return true;
     }
 
-    if (Node->IsA<UK2Node_DynamicCast>())
+    if (Class->IsChildOf<UK2Node_DynamicCast>())
     {
         OutType = EN2CNodeType::DynamicCast;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EaseFunction>())
+    if (Class->IsChildOf<UK2Node_EaseFunction>())
     {
         OutType = EN2CNodeType::EaseFunction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EditablePinBase>())
+    if (Class->IsChildOf<UK2Node_EditablePinBase>())
     {
         OutType = EN2CNodeType::EditablePinBase;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EnumEquality>())
+    if (Class->IsChildOf<UK2Node_EnumEquality>())
     {
         OutType = EN2CNodeType::EnumEquality;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EnumInequality>())
+    if (Class->IsChildOf<UK2Node_EnumInequality>())
     {
         OutType = EN2CNodeType::EnumInequality;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EnumLiteral>())
+    if (Class->IsChildOf<UK2Node_EnumLiteral>())
     {
         OutType = EN2CNodeType::EnumLiteral;
         return true;
     }
 
-    if (Node->IsA<UK2Node_EventNodeInterface>())
+    if (Class->IsChildOf<UK2Node_EventNodeInterface>())
     {
         OutType = EN2CNodeType::EventNodeInterface;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ExecutionSequence>())
+    if (Class->IsChildOf<UK2Node_ExecutionSequence>())
     {
         OutType = EN2CNodeType::Sequence;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ExternalGraphInterface>())
+    if (Class->IsChildOf<UK2Node_ExternalGraphInterface>())
     {
         OutType = EN2CNodeType::ExternalGraphInterface;
         return true;
     }
 
-    if (Node->IsA<UK2Node_ForEachElementInEnum>())
+    if (Class->IsChildOf<UK2Node_ForEachElementInEnum>())
     {
         OutType = EN2CNodeType::ForEachElementInEnum;
         return true;
     }
 
-    if (Node->IsA<UK2Node_FormatText>())
+    if (Class->IsChildOf<UK2Node_FormatText>())
     {
         OutType = EN2CNodeType::FormatText;
         return true;
     }
 
-    if (Node->IsA<UK2Node_FunctionEntry>())
+    if (Class->IsChildOf<UK2Node_FunctionEntry>())
     {
         OutType = EN2CNodeType::FunctionEntry;
         return true;
     }
 
-    if (Node->IsA<UK2Node_FunctionResult>())
+    if (Class->IsChildOf<UK2Node_FunctionResult>())
     {
         OutType = EN2CNodeType::FunctionResult;
         return true;
     }
 
-    if (Node->IsA<UK2Node_FunctionTerminator>())
+    if (Class->IsChildOf<UK2Node_FunctionTerminator>())
     {
         OutType = EN2CNodeType::FunctionTerminator;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GenericCreateObject>())
+    if (Class->IsChildOf<UK2Node_GenericCreateObject>())
     {
         OutType = EN2CNodeType::GenericCreateObject;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetArrayItem>())
+    if (Class->IsChildOf<UK2Node_GetArrayItem>())
     {
         OutType = EN2CNodeType::GetArrayItem;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetClassDefaults>())
+    if (Class->IsChildOf<UK2Node_GetClassDefaults>())
     {
         OutType = EN2CNodeType::GetClassDefaults;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetDataTableRow>())
+    if (Class->IsChildOf<UK2Node_GetDataTableRow>())
     {
         OutType = EN2CNodeType::GetDataTableRow;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetEnumeratorName>())
+    if (Class->IsChildOf<UK2Node_GetEnumeratorName>())
     {
         OutType = EN2CNodeType::GetEnumeratorName;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetEnumeratorNameAsString>())
+    if (Class->IsChildOf<UK2Node_GetEnumeratorNameAsString>())
     {
         OutType = EN2CNodeType::GetEnumeratorNameAsString;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetInputAxisKeyValue>())
+    if (Class->IsChildOf<UK2Node_GetInputAxisKeyValue>())
     {
         OutType = EN2CNodeType::GetInputAxisKeyValue;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetInputAxisValue>())
+    if (Class->IsChildOf<UK2Node_GetInputAxisValue>())
     {
         OutType = EN2CNodeType::GetInputAxisValue;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetInputVectorAxisValue>())
+    if (Class->IsChildOf<UK2Node_GetInputVectorAxisValue>())
     {
         OutType = EN2CNodeType::GetInputVectorAxisValue;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetNumEnumEntries>())
+    if (Class->IsChildOf<UK2Node_GetNumEnumEntries>())
     {
         OutType = EN2CNodeType::GetNumEnumEntries;
         return true;
     }
 
-    if (Node->IsA<UK2Node_GetSubsystem>())
+    if (Class->IsChildOf<UK2Node_GetSubsystem>())
     {
         OutType = EN2CNodeType::GetSubsystem;
         return true;
     }
 
-    if (Node->IsA<UK2Node_IfThenElse>())
+    if (Class->IsChildOf<UK2Node_IfThenElse>())
     {
         OutType = EN2CNodeType::Branch;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputAction>())
+    if (Class->IsChildOf<UK2Node_InputAction>())
     {
         OutType = EN2CNodeType::InputAction;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputActionEvent>())
+    if (Class->IsChildOf<UK2Node_InputActionEvent>())
     {
         OutType = EN2CNodeType::InputActionEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputAxisEvent>())
+    if (Class->IsChildOf<UK2Node_InputAxisEvent>())
     {
         OutType = EN2CNodeType::InputAxisEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputAxisKeyEvent>())
+    if (Class->IsChildOf<UK2Node_InputAxisKeyEvent>())
     {
         OutType = EN2CNodeType::InputAxisKeyEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputKey>())
+    if (Class->IsChildOf<UK2Node_InputKey>())
     {
         OutType = EN2CNodeType::InputKey;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputKeyEvent>())
+    if (Class->IsChildOf<UK2Node_InputKeyEvent>())
     {
         OutType = EN2CNodeType::InputKeyEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputTouch>())
+    if (Class->IsChildOf<UK2Node_InputTouch>())
     {
         OutType = EN2CNodeType::InputTouch;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputTouchEvent>())
+    if (Class->IsChildOf<UK2Node_InputTouchEvent>())
     {
         OutType = EN2CNodeType::InputTouchEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_InputVectorAxisEvent>())
+    if (Class->IsChildOf<UK2Node_InputVectorAxisEvent>())
     {
         OutType = EN2CNodeType::InputVectorAxisEvent;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Knot>())
+    if (Class->IsChildOf<UK2Node_Knot>())
     {
         OutType = EN2CNodeType::Knot;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Literal>())
+    if (Class->IsChildOf<UK2Node_Literal>())
     {
         OutType = EN2CNodeType::Literal;
         return true;
     }
 
-    if (Node->IsA<UK2Node_LoadAsset>())
+    if (Class->IsChildOf<UK2Node_LoadAsset>())
     {
         OutType = EN2CNodeType::LoadAsset;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MacroInstance>())
+    if (Class->IsChildOf<UK2Node_MacroInstance>())
     {
         OutType = EN2CNodeType::MacroInstance;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MakeArray>())
+    if (Class->IsChildOf<UK2Node_MakeArray>())
     {
         OutType = EN2CNodeType::MakeArray;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MakeContainer>())
+    if (Class->IsChildOf<UK2Node_MakeContainer>())
     {
         OutType = EN2CNodeType::MakeContainer;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MakeMap>())
+    if (Class->IsChildOf<UK2Node_MakeMap>())
     {
         OutType = EN2CNodeType::MakeMap;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MakeSet>())
+    if (Class->IsChildOf<UK2Node_MakeSet>())
     {
         OutType = EN2CNodeType::MakeSet;
         return true;
     }
     
-    if (Node->IsA<UK2Node_MakeVariable>())
+    if (Class->IsChildOf<UK2Node_MakeVariable>())
     {
         OutType = EN2CNodeType::MakeVariable;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MathExpression>())
+    if (Class->IsChildOf<UK2Node_MathExpression>())
     {
         OutType = EN2CNodeType::MathExpression;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Message>())
+    if (Class->IsChildOf<UK2Node_Message>())
     {
         OutType = EN2CNodeType::Message;
         return true;
     }
 
-    if (Node->IsA<UK2Node_MultiGate>())
+    if (Class->IsChildOf<UK2Node_MultiGate>())
     {
         OutType = EN2CNodeType::MultiGate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_PromotableOperator>())
+    if (Class->IsChildOf<UK2Node_PromotableOperator>())
     {
         OutType = EN2CNodeType::PromotableOperator;
         return true;
     }
 
-    if (Node->IsA<UK2Node_PureAssignmentStatement>())
+    if (Class->IsChildOf<UK2Node_PureAssignmentStatement>())
     {
         OutType = EN2CNodeType::PureAssignmentStatement;
         return true;
     }
 
-    if (Node->IsA<UK2Node_RemoveDelegate>())
+    if (Class->IsChildOf<UK2Node_RemoveDelegate>())
     {
         OutType = EN2CNodeType::RemoveDelegate;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Select>())
+    if (Class->IsChildOf<UK2Node_Select>())
     {
         OutType = EN2CNodeType::Select;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Self>())
+    if (Class->IsChildOf<UK2Node_Self>())
     {
         OutType = EN2CNodeType::Self;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SetFieldsInStruct>())
+    if (Class->IsChildOf<UK2Node_SetFieldsInStruct>())
     {
         OutType = EN2CNodeType::SetFieldsInStruct;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SetVariableOnPersistentFrame>())
+    if (Class->IsChildOf<UK2Node_SetVariableOnPersistentFrame>())
     {
         OutType = EN2CNodeType::SetVariableOnPersistentFrame;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SpawnActor>())
+    if (Class->IsChildOf<UK2Node_SpawnActor>())
     {
         OutType = EN2CNodeType::SpawnActor;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SpawnActorFromClass>())
+    if (Class->IsChildOf<UK2Node_SpawnActorFromClass>())
     {
         OutType = EN2CNodeType::SpawnActorFromClass; 
         return true;
     }
 
-    if (Node->IsA<UK2Node_StructMemberGet>())
+    if (Class->IsChildOf<UK2Node_StructMemberGet>())
     {
         OutType = EN2CNodeType::StructMemberGet;
         return true;
     }
 
-    if (Node->IsA<UK2Node_StructMemberSet>())
+    if (Class->IsChildOf<UK2Node_StructMemberSet>())
     {
         OutType = EN2CNodeType::StructMemberSet;
         return true;
     }
 
-    if (Node->IsA<UK2Node_StructOperation>())
+    if (Class->IsChildOf<UK2Node_StructOperation>())
     {
         OutType = EN2CNodeType::StructOperation;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Switch>())
+    if (Class->IsChildOf<UK2Node_Switch>())
     {
         OutType = EN2CNodeType::Switch;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SwitchEnum>())
+    if (Class->IsChildOf<UK2Node_SwitchEnum>())
     {
         OutType = EN2CNodeType::SwitchEnum;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SwitchInteger>())
+    if (Class->IsChildOf<UK2Node_SwitchInteger>())
     {
         OutType = EN2CNodeType::SwitchInt;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SwitchName>())
+    if (Class->IsChildOf<UK2Node_SwitchName>())
     {
         OutType = EN2CNodeType::SwitchName;
         return true;
     }
 
-    if (Node->IsA<UK2Node_SwitchString>())
+    if (Class->IsChildOf<UK2Node_SwitchString>())
     {
         OutType = EN2CNodeType::SwitchString;
         return true;
     }
 
-    if (Node->IsA<UK2Node_TemporaryVariable>())
+    if (Class->IsChildOf<UK2Node_TemporaryVariable>())
     {
         OutType = EN2CNodeType::TemporaryVariable;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Timeline>())
+    if (Class->IsChildOf<UK2Node_Timeline>())
     {
         OutType = EN2CNodeType::Timeline;
         return true;
     }
 
-    if (Node->IsA<UK2Node_Tunnel>())
+    if (Class->IsChildOf<UK2Node_Tunnel>())
     {
         OutType = EN2CNodeType::Tunnel;
         return true;
     }
 
-    if (Node->IsA<UK2Node_TunnelBoundary>())
+    if (Class->IsChildOf<UK2Node_TunnelBoundary>())
     {
         OutType = EN2CNodeType::TunnelBoundary;
         return true;
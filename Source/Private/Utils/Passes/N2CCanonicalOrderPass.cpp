@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CCanonicalOrderPass.h"
+
+#include "Hash/CityHash.h"
+#include "Utils/N2CGraphHasher.h"
+
+namespace N2CCanonicalOrder
+{
+    /** Rounds of neighbourhood refinement applied to the node keys */
+    constexpr int32 KeyRefinementRounds = 3;
+
+    uint64 HashKey(uint64 Value, uint64 Seed)
+    {
+        return CityHash64WithSeed(reinterpret_cast<const char*>(&Value), sizeof(Value), Seed);
+    }
+}
+
+bool FN2CCanonicalOrderPass::Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult)
+{
+    const int32 NumNodes = Graph.Nodes.Num();
+    if (NumNodes == 0)
+    {
+        return false;
+    }
+
+    // Producers of each node's inputs in pin order, and execution neighbours
+    TArray<TArray<int32>> DataSources;
+    TArray<TArray<int32>> ExecSuccessors;
+    TArray<TArray<int32>> ExecPredecessors;
+    DataSources.SetNum(NumNodes);
+    ExecSuccessors.SetNum(NumNodes);
+    ExecPredecessors.SetNum(NumNodes);
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        DataSources[NodeIndex].Init(INDEX_NONE, Graph.Nodes[NodeIndex].InputPins.Num());
+    }
+
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode) && Graph.Nodes.IsValidIndex(Edge.TargetNode)
+            && DataSources[Edge.TargetNode].IsValidIndex(Edge.TargetPin))
+        {
+            DataSources[Edge.TargetNode][Edge.TargetPin] = Edge.SourceNode;
+        }
+    }
+
+    for (const FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        if (Graph.Nodes.IsValidIndex(Edge.SourceNode) && Graph.Nodes.IsValidIndex(Edge.TargetNode))
+        {
+            ExecSuccessors[Edge.SourceNode].AddUnique(Edge.TargetNode);
+            ExecPredecessors[Edge.TargetNode].AddUnique(Edge.SourceNode);
+        }
+    }
+
+    const TArray<uint64> Keys = ComputeNodeKeys(Graph, DataSources, ExecSuccessors, ExecPredecessors);
+
+    // Ties between identical keys fall back to the old order; such nodes are interchangeable
+    auto ByKey = [&Keys](int32 A, int32 B)
+    {
+        return Keys[A] != Keys[B] ? Keys[A] < Keys[B] : A < B;
+    };
+
+    for (TArray<int32>& Successors : ExecSuccessors)
+    {
+        Successors.Sort(ByKey);
+    }
+
+    // Only pure producers are pulled in ahead of their consumer; impure ones run where execution reaches them
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        DataSources[NodeIndex].RemoveAll([&Graph, &ExecPredecessors](int32 Source)
+        {
+            return Source == INDEX_NONE || !Graph.Nodes[Source].bPure || ExecPredecessors[Source].Num() > 0;
+        });
+    }
+
+    TArray<int32> NewOrder;
+    NewOrder.Reserve(NumNodes);
+    TBitArray<> Visited(false, NumNodes);
+
+    // Depth-first walk: a node's pure inputs, the node, then its execution successors
+    TArray<TPair<int32, int32>> Stack;
+    auto Walk = [&](int32 StartIndex)
+    {
+        if (Visited[StartIndex])
+        {
+            return;
+        }
+
+        Visited[StartIndex] = true;
+        Stack.Add(TPair<int32, int32>(StartIndex, 0));
+
+        while (Stack.Num() > 0)
+        {
+            const int32 NodeIndex = Stack.Last().Key;
+            const int32 Step = Stack.Last().Value++;
+            const TArray<int32>& Inputs = DataSources[NodeIndex];
+            const TArray<int32>& Successors = ExecSuccessors[NodeIndex];
+
+            int32 Next = INDEX_NONE;
+            if (Step < Inputs.Num())
+            {
+                Next = Inputs[Step];
+            }
+            else if (Step == Inputs.Num())
+            {
+                NewOrder.Add(NodeIndex);
+                continue;
+            }
+            else if (Step - Inputs.Num() - 1 < Successors.Num())
+            {
+                Next = Successors[Step - Inputs.Num() - 1];
+            }
+            else
+            {
+                Stack.Pop();
+                continue;
+            }
+
+            if (!Visited[Next])
+            {
+                Visited[Next] = true;
+                Stack.Add(TPair<int32, int32>(Next, 0));
+            }
+        }
+    };
+
+    TArray<int32> Roots;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (!Graph.Nodes[NodeIndex].bPure && ExecPredecessors[NodeIndex].Num() == 0)
+        {
+            Roots.Add(NodeIndex);
+        }
+    }
+    Roots.Sort(ByKey);
+
+    for (int32 Root : Roots)
+    {
+        Walk(Root);
+    }
+
+    // Whatever execution never reaches, such as unused pure nodes or entry-less loops
+    TArray<int32> Remaining;
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (!Visited[NodeIndex])
+        {
+            Remaining.Add(NodeIndex);
+        }
+    }
+    Remaining.Sort(ByKey);
+
+    for (int32 NodeIndex : Remaining)
+    {
+        Walk(NodeIndex);
+    }
+
+    check(NewOrder.Num() == NumNodes);
+
+    bool bChanged = false;
+    for (int32 NewIndex = 0; NewIndex < NumNodes && !bChanged; ++NewIndex)
+    {
+        bChanged = NewOrder[NewIndex] != NewIndex;
+    }
+
+    if (bChanged)
+    {
+        ReorderNodes(Graph, NewOrder);
+    }
+
+    // Edges follow the new node order
+    const TArray<FN2CExecEdge> OldExecution = Graph.Flows.Execution;
+    const TArray<FN2CDataEdge> OldData = Graph.Flows.Data;
+
+    Graph.Flows.Execution.Sort([](const FN2CExecEdge& A, const FN2CExecEdge& B)
+    {
+        return A.SourceNode != B.SourceNode ? A.SourceNode < B.SourceNode : A.TargetNode < B.TargetNode;
+    });
+
+    Graph.Flows.Data.Sort([](const FN2CDataEdge& A, const FN2CDataEdge& B)
+    {
+        if (A.SourceNode != B.SourceNode)
+        {
+            return A.SourceNode < B.SourceNode;
+        }
+        if (A.SourcePin != B.SourcePin)
+        {
+            return A.SourcePin < B.SourcePin;
+        }
+        return A.TargetNode != B.TargetNode ? A.TargetNode < B.TargetNode : A.TargetPin < B.TargetPin;
+    });
+
+    return bChanged || OldExecution != Graph.Flows.Execution || OldData != Graph.Flows.Data;
+}
+
+TArray<uint64> FN2CCanonicalOrderPass::ComputeNodeKeys(const FN2CGraph& Graph, const TArray<TArray<int32>>& DataSources,
+    const TArray<TArray<int32>>& ExecSuccessors, const TArray<TArray<int32>>& ExecPredecessors)
+{
+    using namespace N2CCanonicalOrder;
+
+    const int32 NumNodes = Graph.Nodes.Num();
+
+    TArray<uint64> Keys;
+    Keys.SetNumUninitialized(NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Keys[NodeIndex] = FN2CGraphHasher::HashNodeContent(Graph.Nodes[NodeIndex]);
+    }
+
+    TArray<uint64> NewKeys;
+    NewKeys.SetNumUninitialized(NumNodes);
+    TArray<uint64> NeighbourKeys;
+
+    for (int32 Round = 0; Round < KeyRefinementRounds; ++Round)
+    {
+        for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+        {
+            uint64 Key = Keys[NodeIndex];
+
+            // Inputs are ordered by pin, so they are hashed in place
+            for (int32 Source : DataSources[NodeIndex])
+            {
+                Key = HashKey(Source != INDEX_NONE ? Keys[Source] : 0, Key);
+            }
+
+            // Execution neighbours have no order of their own
+            for (const TArray<int32>* Neighbours : { &ExecSuccessors[NodeIndex], &ExecPredecessors[NodeIndex] })
+            {
+                NeighbourKeys.Reset();
+                for (int32 Neighbour : *Neighbours)
+                {
+                    NeighbourKeys.Add(Keys[Neighbour]);
+                }
+                NeighbourKeys.Sort();
+
+                Key = HashKey(NeighbourKeys.Num(), Key);
+                for (uint64 NeighbourKey : NeighbourKeys)
+                {
+                    Key = HashKey(NeighbourKey, Key);
+                }
+            }
+
+            NewKeys[NodeIndex] = Key;
+        }
+
+        Swap(Keys, NewKeys);
+    }
+
+    return Keys;
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CDeadNodePass.h"
+
+bool FN2CDeadNodePass::Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult)
+{
+    const int32 NumNodes = Graph.Nodes.Num();
+    if (NumNodes == 0)
+    {
+        return false;
+    }
+
+    // Successors along execution, and producers of each node's inputs
+    TArray<TArray<int32>> ExecSuccessors;
+    TArray<TArray<int32>> DataSources;
+    ExecSuccessors.SetNum(NumNodes);
+    DataSources.SetNum(NumNodes);
+
+    for (const FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        if (ExecSuccessors.IsValidIndex(Edge.SourceNode) && ExecSuccessors.IsValidIndex(Edge.TargetNode))
+        {
+            ExecSuccessors[Edge.SourceNode].Add(Edge.TargetNode);
+        }
+    }
+
+    for (const FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        if (DataSources.IsValidIndex(Edge.SourceNode) && DataSources.IsValidIndex(Edge.TargetNode))
+        {
+            DataSources[Edge.TargetNode].Add(Edge.SourceNode);
+        }
+    }
+
+    TBitArray<> KeepNodes(false, NumNodes);
+    TArray<int32> Stack;
+    Stack.Reserve(NumNodes);
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (IsExecRoot(Graph.Nodes[NodeIndex]))
+        {
+            KeepNodes[NodeIndex] = true;
+            Stack.Add(NodeIndex);
+        }
+    }
+
+    if (Stack.Num() == 0)
+    {
+        return false;
+    }
+
+    // Everything execution reaches from an entry point
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeIndex = Stack.Pop();
+        for (int32 Successor : ExecSuccessors[NodeIndex])
+        {
+            if (!KeepNodes[Successor])
+            {
+                KeepNodes[Successor] = true;
+                Stack.Add(Successor);
+            }
+        }
+    }
+
+    // Plus whatever feeds the reachable nodes, transitively
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (KeepNodes[NodeIndex])
+        {
+            Stack.Add(NodeIndex);
+        }
+    }
+
+    while (Stack.Num() > 0)
+    {
+        const int32 NodeIndex = Stack.Pop();
+        for (int32 Source : DataSources[NodeIndex])
+        {
+            if (!KeepNodes[Source])
+            {
+                KeepNodes[Source] = true;
+                Stack.Add(Source);
+            }
+        }
+    }
+
+    const int32 NodesBefore = OutResult.NodesRemoved;
+    RemoveNodes(Graph, KeepNodes, OutResult);
+    return OutResult.NodesRemoved > NodesBefore;
+}
+
+bool FN2CDeadNodePass::IsExecRoot(const FN2CNodeDefinition& Node)
+{
+    switch (Node.NodeType)
+    {
+        case EN2CNodeType::Event:
+        case EN2CNodeType::CustomEvent:
+        case EN2CNodeType::FunctionEntry:
+            return true;
+        default:
+            break;
+    }
+
+    if (Node.bPure)
+    {
+        return false;
+    }
+
+    // Input events, bound events and tunnel entries start execution without being entered
+    for (const FN2CPinDefinition& Pin : Node.InputPins)
+    {
+        if (Pin.Type == EN2CPinType::Exec)
+        {
+            return false;
+        }
+    }
+
+    for (const FN2CPinDefinition& Pin : Node.OutputPins)
+    {
+        if (Pin.Type == EN2CPinType::Exec)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CDefaultValuePass.h"
+
+namespace
+{
+    /** Approximate characters per token of the JSON payload */
+    constexpr int32 CharsPerToken = 4;
+
+    /** Characters a "default_value" field adds besides the value itself */
+    constexpr int32 DefaultValueKeyChars = 19;
+}
+
+bool FN2CDefaultValuePass::Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult)
+{
+    int32 CharsRemoved = 0;
+    const int32 ValuesBefore = OutResult.ValuesRemoved;
+
+    for (FN2CNodeDefinition& Node : Graph.Nodes)
+    {
+        for (FN2CPinDefinition& Pin : Node.InputPins)
+        {
+            if (Pin.bConnected || !Pin.bHasAutogeneratedDefault || Pin.DefaultValue.IsEmpty() || !IsZeroValue(Pin))
+            {
+                continue;
+            }
+
+            CharsRemoved += DefaultValueKeyChars + Pin.DefaultValue.Len();
+            Pin.DefaultValue.Reset();
+            ++OutResult.ValuesRemoved;
+        }
+    }
+
+    OutResult.TokensSaved += CharsRemoved / CharsPerToken;
+    return OutResult.ValuesRemoved > ValuesBefore;
+}
+
+bool FN2CDefaultValuePass::IsZeroValue(const FN2CPinDefinition& Pin)
+{
+    // Containers are always empty by default; their value is an element, not the container
+    if (Pin.bIsArray || Pin.bIsMap || Pin.bIsSet)
+    {
+        return false;
+    }
+
+    const FString& Value = Pin.DefaultValue;
+
+    switch (Pin.Type)
+    {
+        case EN2CPinType::Boolean:
+            return Value.Equals(TEXT("false"), ESearchCase::IgnoreCase);
+
+        case EN2CPinType::Byte:
+        case EN2CPinType::Integer:
+        case EN2CPinType::Integer64:
+        case EN2CPinType::Float:
+        case EN2CPinType::Double:
+        case EN2CPinType::Real:
+        case EN2CPinType::Vector:
+        case EN2CPinType::Vector2D:
+        case EN2CPinType::Vector4D:
+        case EN2CPinType::Rotator:
+            return AreComponentsZero(Value);
+
+        case EN2CPinType::Name:
+        case EN2CPinType::Object:
+        case EN2CPinType::Class:
+        case EN2CPinType::Interface:
+        case EN2CPinType::SoftObject:
+        case EN2CPinType::SoftClass:
+            return Value.Equals(TEXT("None"), ESearchCase::IgnoreCase);
+
+        default:
+            // Enums, structs and the rest have no zero value that is spelled the same everywhere
+            return false;
+    }
+}
+
+bool FN2CDefaultValuePass::AreComponentsZero(const FString& Value)
+{
+    FString Components = Value.TrimStartAndEnd();
+    Components.RemoveFromStart(TEXT("("));
+    Components.RemoveFromEnd(TEXT(")"));
+
+    TArray<FString> Parts;
+    Components.ParseIntoArray(Parts, TEXT(","));
+    if (Parts.Num() == 0)
+    {
+        return false;
+    }
+
+    for (FString& Part : Parts)
+    {
+        // Drop component labels such as "X="
+        int32 EqualsIndex;
+        if (Part.FindChar(TEXT('='), EqualsIndex))
+        {
+            Part.RightChopInline(EqualsIndex + 1);
+        }
+
+        Part.TrimStartAndEndInline();
+        if (!Part.IsNumeric() || FCString::Atod(*Part) != 0.0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
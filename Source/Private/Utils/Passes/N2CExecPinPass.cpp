@@ -0,0 +1,29 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CExecPinPass.h"
+
+bool FN2CExecPinPass::Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult)
+{
+    return RemovePinsIf(Graph, [](const FN2CNodeDefinition& Node, const FN2CPinDefinition& Pin, bool bIsInput)
+    {
+        if (Pin.Type != EN2CPinType::Exec || Pin.bConnected)
+        {
+            return false;
+        }
+
+        return !bIsInput || HasLinkedExecInput(Node);
+    }, OutResult);
+}
+
+bool FN2CExecPinPass::HasLinkedExecInput(const FN2CNodeDefinition& Node)
+{
+    for (const FN2CPinDefinition& Pin : Node.InputPins)
+    {
+        if (Pin.Type == EN2CPinType::Exec && Pin.bConnected)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
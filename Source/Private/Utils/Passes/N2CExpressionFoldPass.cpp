@@ -0,0 +1,417 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CExpressionFoldPass.h"
+
+bool FN2CExpressionFoldPass::Run(FN2CGraph& InGraph, FN2CGraphPassResult& OutResult)
+{
+    const int32 NumNodes = InGraph.Nodes.Num();
+    if (NumNodes < 2)
+    {
+        return false;
+    }
+
+    Graph = &InGraph;
+
+    // Incoming edge of every input pin and the outgoing edges of every node
+    InputEdges.Reset();
+    InputEdges.SetNum(NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        InputEdges[NodeIndex].Init(INDEX_NONE, InGraph.Nodes[NodeIndex].InputPins.Num());
+    }
+
+    TArray<int32> NumOutgoing;
+    TArray<int32> OutgoingEdge;
+    NumOutgoing.Init(0, NumNodes);
+    OutgoingEdge.Init(INDEX_NONE, NumNodes);
+
+    for (int32 EdgeIndex = 0; EdgeIndex < InGraph.Flows.Data.Num(); ++EdgeIndex)
+    {
+        const FN2CDataEdge& Edge = InGraph.Flows.Data[EdgeIndex];
+        if (!InGraph.Nodes.IsValidIndex(Edge.SourceNode) || !InGraph.Nodes.IsValidIndex(Edge.TargetNode))
+        {
+            continue;
+        }
+
+        if (InGraph.Nodes[Edge.TargetNode].IsInputPinIndex(Edge.TargetPin))
+        {
+            InputEdges[Edge.TargetNode][Edge.TargetPin] = EdgeIndex;
+        }
+        ++NumOutgoing[Edge.SourceNode];
+        OutgoingEdge[Edge.SourceNode] = EdgeIndex;
+    }
+
+    // A foldable node whose single use is an input of another foldable node is folded into it
+    TBitArray<> Foldable(false, NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        Foldable[NodeIndex] = IsFoldable(InGraph.Nodes[NodeIndex]);
+    }
+
+    FoldTarget.Init(INDEX_NONE, NumNodes);
+    TArray<int32> NumFolded;
+    NumFolded.Init(0, NumNodes);
+
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (!Foldable[NodeIndex] || NumOutgoing[NodeIndex] != 1)
+        {
+            continue;
+        }
+
+        const FN2CDataEdge& Edge = InGraph.Flows.Data[OutgoingEdge[NodeIndex]];
+        if (Edge.TargetNode != NodeIndex && Foldable[Edge.TargetNode]
+            && InGraph.Nodes[Edge.TargetNode].IsInputPinIndex(Edge.TargetPin))
+        {
+            FoldTarget[NodeIndex] = Edge.TargetNode;
+            ++NumFolded[Edge.TargetNode];
+        }
+    }
+
+    // Build an expression for every tree root that has something folded into it
+    TArray<int32> TreeRoot;
+    TreeRoot.Init(INDEX_NONE, NumNodes);
+    TArray<int32> OldNumInputs;
+    OldNumInputs.Init(0, NumNodes);
+    ExpressionPins.Reset();
+    ExpressionPins.SetNum(NumNodes);
+
+    const int32 FirstFolded = InGraph.FoldedExpressions.Num();
+    for (int32 RootIndex = 0; RootIndex < NumNodes; ++RootIndex)
+    {
+        if (!Foldable[RootIndex] || FoldTarget[RootIndex] != INDEX_NONE || NumFolded[RootIndex] == 0)
+        {
+            continue;
+        }
+
+        FExpressionBuilder ExpressionBuilder;
+        Builder = &ExpressionBuilder;
+
+        bool bInfix = false;
+        const FString Expression = RenderNode(RootIndex, bInfix);
+
+        Builder = nullptr;
+
+        FN2CFoldedExpression& Folded = InGraph.FoldedExpressions.AddDefaulted_GetRef();
+        Folded.ExpressionNode = RootIndex;
+        for (int32 SourceNode : ExpressionBuilder.SourceNodes)
+        {
+            Folded.SourceDefinitions.Add(InGraph.Nodes[SourceNode]);
+            TreeRoot[SourceNode] = RootIndex;
+        }
+
+        FN2CNodeDefinition& Root = InGraph.Nodes[RootIndex];
+        const int32 TokensBefore = EstimateNodeTokens(Root);
+
+        FN2CNodeDefinition ExpressionNode;
+        ExpressionNode.NodeType = EN2CNodeType::MathExpression;
+        ExpressionNode.Name = Expression;
+        ExpressionNode.Comment = FString::Join(ExpressionBuilder.Comments, TEXT("; "));
+        ExpressionNode.bPure = true;
+        ExpressionNode.InputPins = MoveTemp(ExpressionBuilder.InputPins);
+        ExpressionNode.OutputPins = Root.OutputPins;
+
+        OldNumInputs[RootIndex] = Root.InputPins.Num();
+        Root = MoveTemp(ExpressionNode);
+
+        OutResult.TokensSaved += TokensBefore - EstimateNodeTokens(Root);
+    }
+
+    Graph = nullptr;
+
+    if (InGraph.FoldedExpressions.Num() == FirstFolded)
+    {
+        return false;
+    }
+
+    // Drop edges inside a tree and move the others onto the expression nodes
+    int32 NumKeptEdges = 0;
+    for (int32 EdgeIndex = 0; EdgeIndex < InGraph.Flows.Data.Num(); ++EdgeIndex)
+    {
+        FN2CDataEdge Edge = InGraph.Flows.Data[EdgeIndex];
+        const int32 SourceRoot = InGraph.Nodes.IsValidIndex(Edge.SourceNode) ? TreeRoot[Edge.SourceNode] : INDEX_NONE;
+        const int32 TargetRoot = InGraph.Nodes.IsValidIndex(Edge.TargetNode) ? TreeRoot[Edge.TargetNode] : INDEX_NONE;
+
+        if (SourceRoot != INDEX_NONE && (SourceRoot == TargetRoot || Edge.SourceNode != SourceRoot))
+        {
+            continue;
+        }
+
+        if (TargetRoot != INDEX_NONE)
+        {
+            const TArray<int32>& Pins = ExpressionPins[Edge.TargetNode];
+            if (!Pins.IsValidIndex(Edge.TargetPin) || Pins[Edge.TargetPin] == INDEX_NONE)
+            {
+                continue;
+            }
+            Edge.TargetPin = Pins[Edge.TargetPin];
+            Edge.TargetNode = TargetRoot;
+        }
+
+        if (SourceRoot != INDEX_NONE)
+        {
+            Edge.SourcePin += InGraph.Nodes[SourceRoot].InputPins.Num() - OldNumInputs[SourceRoot];
+        }
+
+        InGraph.Flows.Data[NumKeptEdges++] = Edge;
+    }
+
+    OutResult.EdgesRemoved += InGraph.Flows.Data.Num() - NumKeptEdges;
+    InGraph.Flows.Data.SetNum(NumKeptEdges);
+
+    // Everything but the roots is now part of an expression
+    TBitArray<> KeepNodes(true, NumNodes);
+    for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+    {
+        if (TreeRoot[NodeIndex] != INDEX_NONE && TreeRoot[NodeIndex] != NodeIndex)
+        {
+            KeepNodes[NodeIndex] = false;
+        }
+    }
+
+    RemoveNodes(InGraph, KeepNodes, OutResult);
+    return true;
+}
+
+bool FN2CExpressionFoldPass::IsFoldable(const FN2CNodeDefinition& Node)
+{
+    switch (Node.NodeType)
+    {
+        case EN2CNodeType::CallFunction:
+        case EN2CNodeType::CallFunctionOnMember:
+        case EN2CNodeType::CallArrayFunction:
+        case EN2CNodeType::CommutativeAssociativeBinaryOperator:
+        case EN2CNodeType::PromotableOperator:
+        case EN2CNodeType::VariableGet:
+        case EN2CNodeType::LocalVariableGet:
+            break;
+        default:
+            return false;
+    }
+
+    if (!Node.bPure || Node.bLatent || Node.MemberName.IsEmpty() || Node.OutputPins.Num() != 1)
+    {
+        return false;
+    }
+
+    // References would no longer alias anything once written inline
+    const FN2CPinDefinition& Output = Node.OutputPins[0];
+    if (Output.Type == EN2CPinType::Exec || Output.bIsReference)
+    {
+        return false;
+    }
+
+    for (const FN2CPinDefinition& Pin : Node.InputPins)
+    {
+        if (Pin.Type == EN2CPinType::Exec || Pin.bIsReference)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FString FN2CExpressionFoldPass::RenderNode(int32 NodeIndex, bool& bOutInfix)
+{
+    const FN2CNodeDefinition& Node = Graph->Nodes[NodeIndex];
+    Builder->SourceNodes.Add(NodeIndex);
+    if (!Node.Comment.IsEmpty())
+    {
+        Builder->Comments.Add(Node.Comment);
+    }
+
+    ExpressionPins[NodeIndex].Init(INDEX_NONE, Node.InputPins.Num());
+
+    FString Target;
+    TArray<FString> Args;
+    for (int32 PinIndex = 0; PinIndex < Node.InputPins.Num(); ++PinIndex)
+    {
+        const FN2CPinDefinition& Pin = Node.InputPins[PinIndex];
+        const bool bLinked = InputEdges[NodeIndex][PinIndex] != INDEX_NONE;
+
+        if (Pin.bIsSelfTarget)
+        {
+            // An unconnected target is self, which needs no qualifier
+            if (bLinked || !Pin.DefaultValue.IsEmpty())
+            {
+                Target = RenderInput(NodeIndex, PinIndex);
+            }
+            continue;
+        }
+
+        Args.Add(RenderInput(NodeIndex, PinIndex));
+    }
+
+    bOutInfix = false;
+
+    if (Node.NodeType == EN2CNodeType::VariableGet || Node.NodeType == EN2CNodeType::LocalVariableGet)
+    {
+        return Target.IsEmpty() ? Node.MemberName : Target + TEXT(".") + Node.MemberName;
+    }
+
+    if (Target.IsEmpty())
+    {
+        if (const TCHAR* Operator = GetOperator(Node, Args.Num()))
+        {
+            if (Args.Num() == 1)
+            {
+                return FString(Operator) + Args[0];
+            }
+
+            bOutInfix = true;
+            return FString::Join(Args, *FString::Printf(TEXT(" %s "), Operator));
+        }
+    }
+
+    FString Callee = Node.MemberName;
+    Callee.RemoveFromStart(TEXT("K2_"));
+
+    FString Call = FString::Printf(TEXT("%s(%s)"), *Callee, *FString::Join(Args, TEXT(", ")));
+    return Target.IsEmpty() ? Call : Target + TEXT(".") + Call;
+}
+
+FString FN2CExpressionFoldPass::RenderInput(int32 NodeIndex, int32 PinIndex)
+{
+    const FN2CPinDefinition& Pin = Graph->Nodes[NodeIndex].InputPins[PinIndex];
+    const int32 EdgeIndex = InputEdges[NodeIndex][PinIndex];
+
+    if (EdgeIndex != INDEX_NONE)
+    {
+        const int32 SourceNode = Graph->Flows.Data[EdgeIndex].SourceNode;
+        if (FoldTarget[SourceNode] == NodeIndex)
+        {
+            bool bInfix = false;
+            const FString Nested = RenderNode(SourceNode, bInfix);
+            return bInfix ? FString::Printf(TEXT("(%s)"), *Nested) : Nested;
+        }
+    }
+    else
+    {
+        FString Literal = GetInlineLiteral(Pin);
+        if (!Literal.IsEmpty())
+        {
+            return Literal;
+        }
+    }
+
+    ExpressionPins[NodeIndex][PinIndex] = Builder->InputPins.Num();
+    return AddInputPin(Pin);
+}
+
+FString FN2CExpressionFoldPass::AddInputPin(const FN2CPinDefinition& Pin)
+{
+    // Pin names become identifiers in the expression, so they must be unique and free of spaces
+    FString BaseName;
+    for (TCHAR Char : Pin.Name)
+    {
+        if (FChar::IsAlnum(Char) || Char == TEXT('_'))
+        {
+            BaseName.AppendChar(Char);
+        }
+    }
+    if (BaseName.IsEmpty() || FChar::IsDigit(BaseName[0]))
+    {
+        BaseName.InsertAt(0, TEXT("In"));
+    }
+
+    FString Name = BaseName;
+    for (int32 Suffix = 2; Builder->UsedNames.Contains(Name); ++Suffix)
+    {
+        Name = FString::Printf(TEXT("%s%d"), *BaseName, Suffix);
+    }
+    Builder->UsedNames.Add(Name);
+
+    FN2CPinDefinition& ExpressionPin = Builder->InputPins.Add_GetRef(Pin);
+    ExpressionPin.Name = Name;
+    ExpressionPin.bIsSelfTarget = false;
+    return Name;
+}
+
+const TCHAR* FN2CExpressionFoldPass::GetOperator(const FN2CNodeDefinition& Node, int32 NumArgs)
+{
+    if (Node.GetCleanMemberParent() != TEXT("KismetMathLibrary"))
+    {
+        return nullptr;
+    }
+
+    struct FOperator
+    {
+        const TCHAR* Function;
+        const TCHAR* Symbol;
+        bool bAssociative;
+    };
+
+    static const FOperator Operators[] =
+    {
+        { TEXT("Add"), TEXT("+"), true },
+        { TEXT("Subtract"), TEXT("-"), false },
+        { TEXT("Multiply"), TEXT("*"), true },
+        { TEXT("Divide"), TEXT("/"), false },
+        { TEXT("Percent"), TEXT("%"), false },
+        { TEXT("Less"), TEXT("<"), false },
+        { TEXT("Greater"), TEXT(">"), false },
+        { TEXT("LessEqual"), TEXT("<="), false },
+        { TEXT("GreaterEqual"), TEXT(">="), false },
+        { TEXT("EqualEqual"), TEXT("=="), false },
+        { TEXT("NotEqual"), TEXT("!="), false },
+        { TEXT("BooleanAND"), TEXT("&&"), true },
+        { TEXT("BooleanOR"), TEXT("||"), true },
+        { TEXT("And"), TEXT("&"), true },
+        { TEXT("Or"), TEXT("|"), true },
+        { TEXT("Xor"), TEXT("^"), true },
+    };
+
+    // Math library functions are named after the operation and their operand types, e.g. "Add_VectorFloat"
+    FString Operation = Node.MemberName;
+    int32 Separator;
+    if (Node.MemberName.FindChar(TEXT('_'), Separator))
+    {
+        Operation = Node.MemberName.Left(Separator);
+    }
+
+    if (Node.MemberName == TEXT("Not_PreBool"))
+    {
+        return NumArgs == 1 ? TEXT("!") : nullptr;
+    }
+
+    for (const FOperator& Operator : Operators)
+    {
+        if (Operation == Operator.Function)
+        {
+            // Extra inputs such as an error tolerance have no infix form
+            return NumArgs == 2 || (Operator.bAssociative && NumArgs > 2) ? Operator.Symbol : nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+FString FN2CExpressionFoldPass::GetInlineLiteral(const FN2CPinDefinition& Pin)
+{
+    if (Pin.DefaultValue.IsEmpty() || Pin.bIsArray || Pin.bIsMap || Pin.bIsSet)
+    {
+        return FString();
+    }
+
+    switch (Pin.Type)
+    {
+        case EN2CPinType::Boolean:
+        case EN2CPinType::Byte:
+        case EN2CPinType::Integer:
+        case EN2CPinType::Integer64:
+        case EN2CPinType::Float:
+        case EN2CPinType::Double:
+        case EN2CPinType::Real:
+            return Pin.DefaultValue;
+
+        case EN2CPinType::String:
+        case EN2CPinType::Name:
+        case EN2CPinType::Text:
+            return FString::Printf(TEXT("\"%s\""), *Pin.DefaultValue.ReplaceCharWithEscapedChar());
+
+        default:
+            // Vectors, structs and objects stay pins so their type is kept
+            return FString();
+    }
+}
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CGraphPass.h"
+
+#include "Core/N2CGraphScheduler.h"
+
+void FN2CBaseGraphPass::RemoveNodes(FN2CGraph& Graph, const TBitArray<>& KeepNodes, FN2CGraphPassResult& OutResult)
+{
+    check(KeepNodes.Num() == Graph.Nodes.Num());
+
+    // Map old node indices to their compacted position
+    TArray<int32> Remap;
+    Remap.SetNumUninitialized(Graph.Nodes.Num());
+
+    int32 NumKept = 0;
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+    {
+        if (KeepNodes[NodeIndex])
+        {
+            if (NumKept != NodeIndex)
+            {
+                Graph.Nodes[NumKept] = MoveTemp(Graph.Nodes[NodeIndex]);
+            }
+            Remap[NodeIndex] = NumKept++;
+        }
+        else
+        {
+            Remap[NodeIndex] = INDEX_NONE;
+            OutResult.TokensSaved += EstimateNodeTokens(Graph.Nodes[NodeIndex]);
+            ++OutResult.NodesRemoved;
+        }
+    }
+
+    if (NumKept == Graph.Nodes.Num())
+    {
+        return;
+    }
+
+    Graph.Nodes.SetNum(NumKept);
+
+    auto IsValidNode = [&Remap](int32 NodeIndex)
+    {
+        return Remap.IsValidIndex(NodeIndex) && Remap[NodeIndex] != INDEX_NONE;
+    };
+
+    const int32 NumEdges = Graph.Flows.Execution.Num() + Graph.Flows.Data.Num();
+
+    Graph.Flows.Execution.RemoveAll([&IsValidNode](const FN2CExecEdge& Edge)
+    {
+        return !IsValidNode(Edge.SourceNode) || !IsValidNode(Edge.TargetNode);
+    });
+    for (FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        Edge.SourceNode = Remap[Edge.SourceNode];
+        Edge.TargetNode = Remap[Edge.TargetNode];
+    }
+
+    Graph.Flows.Data.RemoveAll([&IsValidNode](const FN2CDataEdge& Edge)
+    {
+        return !IsValidNode(Edge.SourceNode) || !IsValidNode(Edge.TargetNode);
+    });
+    for (FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        Edge.SourceNode = Remap[Edge.SourceNode];
+        Edge.TargetNode = Remap[Edge.TargetNode];
+    }
+
+    OutResult.EdgesRemoved += NumEdges - Graph.Flows.Execution.Num() - Graph.Flows.Data.Num();
+
+    Graph.FoldedExpressions.RemoveAll([&IsValidNode](const FN2CFoldedExpression& Folded)
+    {
+        return !IsValidNode(Folded.ExpressionNode);
+    });
+    for (FN2CFoldedExpression& Folded : Graph.FoldedExpressions)
+    {
+        Folded.ExpressionNode = Remap[Folded.ExpressionNode];
+    }
+}
+
+void FN2CBaseGraphPass::ReorderNodes(FN2CGraph& Graph, const TArray<int32>& NewOrder)
+{
+    check(NewOrder.Num() == Graph.Nodes.Num());
+
+    TArray<int32> Remap;
+    Remap.SetNumUninitialized(Graph.Nodes.Num());
+
+    TArray<FN2CNodeDefinition> Nodes;
+    Nodes.Reserve(Graph.Nodes.Num());
+    for (int32 NewIndex = 0; NewIndex < NewOrder.Num(); ++NewIndex)
+    {
+        Remap[NewOrder[NewIndex]] = NewIndex;
+        Nodes.Add(MoveTemp(Graph.Nodes[NewOrder[NewIndex]]));
+    }
+    Graph.Nodes = MoveTemp(Nodes);
+
+    for (FN2CExecEdge& Edge : Graph.Flows.Execution)
+    {
+        Edge.SourceNode = Remap.IsValidIndex(Edge.SourceNode) ? Remap[Edge.SourceNode] : INDEX_NONE;
+        Edge.TargetNode = Remap.IsValidIndex(Edge.TargetNode) ? Remap[Edge.TargetNode] : INDEX_NONE;
+    }
+
+    for (FN2CDataEdge& Edge : Graph.Flows.Data)
+    {
+        Edge.SourceNode = Remap.IsValidIndex(Edge.SourceNode) ? Remap[Edge.SourceNode] : INDEX_NONE;
+        Edge.TargetNode = Remap.IsValidIndex(Edge.TargetNode) ? Remap[Edge.TargetNode] : INDEX_NONE;
+    }
+
+    for (FN2CFoldedExpression& Folded : Graph.FoldedExpressions)
+    {
+        Folded.ExpressionNode = Remap.IsValidIndex(Folded.ExpressionNode) ? Remap[Folded.ExpressionNode] : INDEX_NONE;
+    }
+}
+
+void FN2CBaseGraphPass::RemovePins(FN2CGraph& Graph, const TArray<TBitArray<>>& KeepPins, FN2CGraphPassResult& OutResult)
+{
+    check(KeepPins.Num() == Graph.Nodes.Num());
+
+    // Map old pin indices to their compacted position, only for nodes that lose pins
+    TArray<TArray<int32>> Remap;
+    Remap.SetNum(Graph.Nodes.Num());
+
+    bool bAnyRemoved = false;
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+    {
+        const TBitArray<>& KeepNodePins = KeepPins[NodeIndex];
+        if (KeepNodePins.Num() == 0 || KeepNodePins.Find(false) == INDEX_NONE)
+        {
+            continue;
+        }
+
+        FN2CNodeDefinition& Node = Graph.Nodes[NodeIndex];
+        check(KeepNodePins.Num() == Node.NumPins());
+
+        const int32 TokensBefore = EstimateNodeTokens(Node);
+        const int32 NumInputs = Node.InputPins.Num();
+
+        TArray<int32>& PinRemap = Remap[NodeIndex];
+        PinRemap.SetNumUninitialized(Node.NumPins());
+
+        int32 NextPinIndex = 0;
+        auto CompactPins = [&](TArray<FN2CPinDefinition>& Pins, int32 FirstPinIndex)
+        {
+            int32 NumKept = 0;
+            for (int32 Index = 0; Index < Pins.Num(); ++Index)
+            {
+                if (KeepNodePins[FirstPinIndex + Index])
+                {
+                    if (NumKept != Index)
+                    {
+                        Pins[NumKept] = MoveTemp(Pins[Index]);
+                    }
+                    ++NumKept;
+                    PinRemap[FirstPinIndex + Index] = NextPinIndex++;
+                }
+                else
+                {
+                    PinRemap[FirstPinIndex + Index] = INDEX_NONE;
+                    ++OutResult.PinsRemoved;
+                }
+            }
+            Pins.SetNum(NumKept);
+        };
+
+        CompactPins(Node.InputPins, 0);
+        CompactPins(Node.OutputPins, NumInputs);
+
+        OutResult.TokensSaved += TokensBefore - EstimateNodeTokens(Node);
+        bAnyRemoved = true;
+    }
+
+    if (!bAnyRemoved)
+    {
+        return;
+    }
+
+    auto RemapPin = [&Remap](int32 NodeIndex, int32& PinIndex)
+    {
+        if (!Remap.IsValidIndex(NodeIndex) || Remap[NodeIndex].Num() == 0)
+        {
+            return true;
+        }
+
+        const TArray<int32>& PinRemap = Remap[NodeIndex];
+        if (!PinRemap.IsValidIndex(PinIndex) || PinRemap[PinIndex] == INDEX_NONE)
+        {
+            return false;
+        }
+
+        PinIndex = PinRemap[PinIndex];
+        return true;
+    };
+
+    int32 NumKeptEdges = 0;
+    for (int32 EdgeIndex = 0; EdgeIndex < Graph.Flows.Data.Num(); ++EdgeIndex)
+    {
+        FN2CDataEdge Edge = Graph.Flows.Data[EdgeIndex];
+        if (RemapPin(Edge.SourceNode, Edge.SourcePin) && RemapPin(Edge.TargetNode, Edge.TargetPin))
+        {
+            Graph.Flows.Data[NumKeptEdges++] = Edge;
+        }
+    }
+
+    OutResult.EdgesRemoved += Graph.Flows.Data.Num() - NumKeptEdges;
+    Graph.Flows.Data.SetNum(NumKeptEdges);
+}
+
+bool FN2CBaseGraphPass::RemovePinsIf(FN2CGraph& Graph,
+    TFunctionRef<bool(const FN2CNodeDefinition&, const FN2CPinDefinition&, bool)> ShouldRemove,
+    FN2CGraphPassResult& OutResult)
+{
+    TArray<TBitArray<>> KeepPins;
+    KeepPins.SetNum(Graph.Nodes.Num());
+
+    bool bAnySelected = false;
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
+    {
+        const FN2CNodeDefinition& Node = Graph.Nodes[NodeIndex];
+        TBitArray<>& KeepNodePins = KeepPins[NodeIndex];
+
+        int32 PinIndex = 0;
+        auto SelectPins = [&](const TArray<FN2CPinDefinition>& Pins, bool bIsInput)
+        {
+            for (const FN2CPinDefinition& Pin : Pins)
+            {
+                if (ShouldRemove(Node, Pin, bIsInput))
+                {
+                    if (KeepNodePins.Num() == 0)
+                    {
+                        KeepNodePins.Init(true, Node.NumPins());
+                    }
+                    KeepNodePins[PinIndex] = false;
+                    bAnySelected = true;
+                }
+                ++PinIndex;
+            }
+        };
+
+        SelectPins(Node.InputPins, true);
+        SelectPins(Node.OutputPins, false);
+    }
+
+    if (!bAnySelected)
+    {
+        return false;
+    }
+
+    RemovePins(Graph, KeepPins, OutResult);
+    return true;
+}
+
+int32 FN2CBaseGraphPass::EstimateNodeTokens(const FN2CNodeDefinition& Node)
+{
+    return FN2CGraphScheduler::EstimateNodeTokens(Node.NumPins());
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#include "Utils/Passes/N2CSelfPinPass.h"
+
+bool FN2CSelfPinPass::Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult)
+{
+    return RemovePinsIf(Graph, [](const FN2CNodeDefinition& Node, const FN2CPinDefinition& Pin, bool bIsInput)
+    {
+        return bIsInput && Pin.bIsSelfTarget && !Pin.bConnected && Pin.DefaultValue.IsEmpty();
+    }, OutResult);
+}
@@ -10,7 +10,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         OutNodeDef.Name = TEXT("Sequence");
         
         // Log sequence details
-        FString SequenceInfo = FString::Printf(TEXT("Sequence Node: %s"), *OutNodeDef.ID);
+        FString SequenceInfo = FString::Printf(TEXT("Sequence Node: %s"), *OutNodeDef.Name);
         FN2CLogger::Get().Log(SequenceInfo, EN2CLogSeverity::Debug);
         return;
     }
@@ -21,7 +21,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         OutNodeDef.Name = TEXT("Branch");
         
         // Log branch details
-        FString BranchInfo = FString::Printf(TEXT("Branch Node: %s"), *OutNodeDef.ID);
+        FString BranchInfo = FString::Printf(TEXT("Branch Node: %s"), *OutNodeDef.Name);
         FN2CLogger::Get().Log(BranchInfo, EN2CLogSeverity::Debug);
         return;
     }
@@ -46,7 +46,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         
         // Log select details
         FString SelectInfo = FString::Printf(TEXT("Select Node: %s, Options: %d"), 
-            *OutNodeDef.ID,
+            *OutNodeDef.Name,
             OptionPins.Num());
         FN2CLogger::Get().Log(SelectInfo, EN2CLogSeverity::Debug);
         return;
@@ -58,7 +58,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         OutNodeDef.Name = TEXT("Switch");
         
         // Log switch details
-        FString SwitchInfo = FString::Printf(TEXT("Switch Node: %s"), *OutNodeDef.ID);
+        FString SwitchInfo = FString::Printf(TEXT("Switch Node: %s"), *OutNodeDef.Name);
         FN2CLogger::Get().Log(SwitchInfo, EN2CLogSeverity::Debug);
         return;
     }
@@ -80,7 +80,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         
         // Log multi-gate details
         FString GateInfo = FString::Printf(TEXT("Multi Gate Node: %s, Outputs: %d"), 
-            *OutNodeDef.ID,
+            *OutNodeDef.Name,
             OutPins.Num());
         FN2CLogger::Get().Log(GateInfo, EN2CLogSeverity::Debug);
         return;
@@ -92,7 +92,7 @@ void FN2CFlowControlProcessor::ExtractNodeProperties(UK2Node* Node, FN2CNodeDefi
         OutNodeDef.Name = TEXT("Do Once Multi Input");
         
         // Log do-once details
-        FString DoOnceInfo = FString::Printf(TEXT("Do Once Multi Input Node: %s"), *OutNodeDef.ID);
+        FString DoOnceInfo = FString::Printf(TEXT("Do Once Multi Input Node: %s"), *OutNodeDef.Name);
         FN2CLogger::Get().Log(DoOnceInfo, EN2CLogSeverity::Debug);
         return;
     }
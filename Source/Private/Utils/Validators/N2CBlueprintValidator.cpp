@@ -118,36 +118,19 @@ bool FN2CBlueprintValidator::ValidateGraph(const FN2CGraph& Graph, FString& OutE
         return false;
     }
 
-    // Build set of node IDs for validation
-    TSet<FString> NodeIds;
-    for (const FN2CNodeDefinition& Node : Graph.Nodes)
+    // Validate each node
+    for (int32 NodeIndex = 0; NodeIndex < Graph.Nodes.Num(); ++NodeIndex)
     {
+        const FN2CNodeDefinition& Node = Graph.Nodes[NodeIndex];
         FString NodeError;
         if (!NodeValidator.Validate(Node, NodeError))
         {
-            OutError = FString::Printf(TEXT("Invalid node %s in graph %s: %s"), *Node.ID, *Graph.Name, *NodeError);
+            OutError = FString::Printf(TEXT("Invalid node %d (%s) in graph %s: %s"), NodeIndex, *Node.Name, *Graph.Name, *NodeError);
             FN2CLogger::Get().LogError(OutError);
             return false;
         }
-
-        // Check for duplicate node IDs
-        if (NodeIds.Contains(Node.ID))
-        {
-            OutError = FString::Printf(TEXT("Duplicate node ID %s in graph %s"), *Node.ID, *Graph.Name);
-            FN2CLogger::Get().LogError(OutError);
-            return false;
-        }
-        NodeIds.Add(Node.ID);
     }
 
-    // Log all node IDs for debugging
-    FString NodeIdList = TEXT("Valid Node IDs in graph ") + Graph.Name + TEXT(": ");
-    for (const FString& Id : NodeIds)
-    {
-        NodeIdList += Id + TEXT(", ");
-    }
-    FN2CLogger::Get().Log(NodeIdList, EN2CLogSeverity::Debug);
-
     // Validate flow references
     if (!ValidateFlowReferences(Graph, OutError))
     {
@@ -162,71 +145,42 @@ bool FN2CBlueprintValidator::ValidateGraph(const FN2CGraph& Graph, FString& OutE
 
 bool FN2CBlueprintValidator::ValidateFlowReferences(const FN2CGraph& Graph, FString& OutError)
 {
-    // Build lookup maps for validation
-    TSet<FString> NodeIds;
-    TMap<FString, TSet<FString>> NodePinIds;
-
-    for (const FN2CNodeDefinition& Node : Graph.Nodes)
-    {
-        NodeIds.Add(Node.ID);
-        
-        // Track all pin IDs for this node
-        TSet<FString>& PinIds = NodePinIds.Add(Node.ID);
-        for (const FN2CPinDefinition& Pin : Node.InputPins)
-        {
-            PinIds.Add(Pin.ID);
-        }
-        for (const FN2CPinDefinition& Pin : Node.OutputPins)
-        {
-            PinIds.Add(Pin.ID);
-        }
-    }
+    const int32 NumNodes = Graph.Nodes.Num();
 
     // Validate execution flows
-    for (const FString& ExecFlow : Graph.Flows.Execution)
+    for (const FN2CExecEdge& ExecFlow : Graph.Flows.Execution)
     {
-        TArray<FString> FlowNodes;
-        ExecFlow.ParseIntoArray(FlowNodes, TEXT("->"));
-        
-        // Each flow must have at least 2 nodes
-        if (FlowNodes.Num() < 2)
+        // Verify both referenced nodes exist
+        if (ExecFlow.SourceNode < 0 || ExecFlow.SourceNode >= NumNodes ||
+            ExecFlow.TargetNode < 0 || ExecFlow.TargetNode >= NumNodes)
         {
-            OutError = FString::Printf(TEXT("Invalid execution flow %s (needs at least 2 nodes) in graph %s"), *ExecFlow, *Graph.Name);
+            OutError = FString::Printf(TEXT("Execution flow %d->%d references non-existent node in graph %s"),
+                ExecFlow.SourceNode, ExecFlow.TargetNode, *Graph.Name);
             FN2CLogger::Get().LogError(OutError);
             return false;
         }
-
-        // Verify all referenced nodes exist
-        for (const FString& NodeId : FlowNodes)
-        {
-            if (!NodeIds.Contains(NodeId))
-            {
-                OutError = FString::Printf(TEXT("Execution flow %s references non-existent node %s in graph %s"), *ExecFlow, *NodeId, *Graph.Name);
-                FN2CLogger::Get().LogError(OutError);
-                return false;
-            }
-        }
     }
 
     // Check data flows
-    for (const auto& DataFlow : Graph.Flows.Data)
+    for (const FN2CDataEdge& DataFlow : Graph.Flows.Data)
     {
-        // Validate source pin format (N#.P#)
-        TArray<FString> SourceParts;
-        DataFlow.Key.ParseIntoArray(SourceParts, TEXT("."));
-        if (SourceParts.Num() != 2 || !NodeIds.Contains(SourceParts[0]))
+        // Source must be an output pin of an existing node
+        if (DataFlow.SourceNode < 0 || DataFlow.SourceNode >= NumNodes ||
+            DataFlow.SourcePin < Graph.Nodes[DataFlow.SourceNode].InputPins.Num() ||
+            DataFlow.SourcePin >= Graph.Nodes[DataFlow.SourceNode].NumPins())
         {
-            OutError = FString::Printf(TEXT("Invalid source pin format %s in graph %s"), *DataFlow.Key, *Graph.Name);
+            OutError = FString::Printf(TEXT("Invalid data flow source %d.%d in graph %s"),
+                DataFlow.SourceNode, DataFlow.SourcePin, *Graph.Name);
             FN2CLogger::Get().LogError(OutError);
             return false;
         }
 
-        // Validate target pin format (N#.P#)
-        TArray<FString> TargetParts;
-        DataFlow.Value.ParseIntoArray(TargetParts, TEXT("."));
-        if (TargetParts.Num() != 2 || !NodeIds.Contains(TargetParts[0]))
+        // Target must be an input pin of an existing node
+        if (DataFlow.TargetNode < 0 || DataFlow.TargetNode >= NumNodes ||
+            !Graph.Nodes[DataFlow.TargetNode].IsInputPinIndex(DataFlow.TargetPin))
         {
-            OutError = FString::Printf(TEXT("Invalid target pin format %s in graph %s"), *DataFlow.Value, *Graph.Name);
+            OutError = FString::Printf(TEXT("Invalid data flow target %d.%d in graph %s"),
+                DataFlow.TargetNode, DataFlow.TargetPin, *Graph.Name);
             FN2CLogger::Get().LogError(OutError);
             return false;
         }
@@ -5,8 +5,7 @@
 bool FN2CPinValidator::Validate(const FN2CPinDefinition& Pin, FString& OutError)
 {
     // Log basic pin info
-    FString PinInfo = FString::Printf(TEXT("Validating Pin: ID=%s, Name=%s, Type=%s, SubType=%s"),
-        *Pin.ID,
+    FString PinInfo = FString::Printf(TEXT("Validating Pin: Name=%s, Type=%s, SubType=%s"),
         *Pin.Name,
         *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)),
         *Pin.SubType);
@@ -32,7 +31,7 @@ bool FN2CPinValidator::Validate(const FN2CPinDefinition& Pin, FString& OutError)
 
     // Log pin flags
     FString FlagInfo = FString::Printf(TEXT("Pin %s flags: Connected=%d, IsRef=%d, IsConst=%d, IsArray=%d, IsMap=%d, IsSet=%d"),
-        *Pin.ID,
+        *Pin.Name,
         Pin.bConnected ? 1 : 0,
         Pin.bIsReference ? 1 : 0,
         Pin.bIsConst ? 1 : 0,
@@ -41,24 +40,17 @@ bool FN2CPinValidator::Validate(const FN2CPinDefinition& Pin, FString& OutError)
         Pin.bIsSet ? 1 : 0);
     FN2CLogger::Get().Log(FlagInfo, EN2CLogSeverity::Debug);
 
-    FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s validation successful"), *Pin.ID), EN2CLogSeverity::Debug);
+    FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s validation successful"), *Pin.Name), EN2CLogSeverity::Debug);
     return true;
 }
 
 bool FN2CPinValidator::ValidateRequired(const FN2CPinDefinition& Pin, FString& OutError)
 {
-    // Check required fields
-    if (Pin.ID.IsEmpty())
-    {
-        OutError = FString::Printf(TEXT("Pin validation warning: Empty ID for pin %s"), *Pin.Name);
-        FN2CLogger::Get().LogWarning(OutError);
-        // Continue despite warning - generate a default ID if needed
-    }
-
     // Allow empty names for all pins
     if (Pin.Name.IsEmpty())
     {
-        FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s has empty name"), *Pin.ID), EN2CLogSeverity::Debug);
+        FN2CLogger::Get().Log(FString::Printf(TEXT("Pin of type %s has empty name"),
+            *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type))), EN2CLogSeverity::Debug);
     }
 
     return true;
@@ -76,26 +68,26 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
             if (Pin.SubType.IsEmpty())
             {
                 OutError = FString::Printf(TEXT("Pin validation warning: Container type %s missing SubType for pin %s"), 
-                    *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)), *Pin.ID);
+                    *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
             // Container flags must match type
             if (Pin.Type == EN2CPinType::Array && !Pin.bIsArray)
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Array type without array flag for pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Array type without array flag for pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
             if (Pin.Type == EN2CPinType::Map && !Pin.bIsMap)
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Map type without map flag for pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Map type without map flag for pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
             if (Pin.Type == EN2CPinType::Set && !Pin.bIsSet)
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Set type without set flag for pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Set type without set flag for pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
@@ -109,7 +101,7 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
             if (Pin.SubType.IsEmpty())
             {
                 OutError = FString::Printf(TEXT("Pin validation warning: %s type missing SubType for pin %s"), 
-                    *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)), *Pin.ID);
+                    *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type)), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
@@ -119,7 +111,7 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
             // Exec pins can't have default values or be const/reference
             if (!Pin.DefaultValue.IsEmpty() || Pin.bIsConst || Pin.bIsReference)
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Invalid Exec pin configuration for pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Invalid Exec pin configuration for pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
@@ -130,7 +122,7 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
             // Delegates can't be const
             if (Pin.bIsConst)
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Const delegate pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Const delegate pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
@@ -141,7 +133,7 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
             // Soft references require class path in SubType
             if (Pin.SubType.IsEmpty())
             {
-                OutError = FString::Printf(TEXT("Pin validation warning: Soft reference missing class path for pin %s"), *Pin.ID);
+                OutError = FString::Printf(TEXT("Pin validation warning: Soft reference missing class path for pin %s"), *Pin.Name);
                 FN2CLogger::Get().LogWarning(OutError);
                 // Continue despite warning
             }
@@ -150,7 +142,7 @@ bool FN2CPinValidator::ValidateTypeSpecific(const FN2CPinDefinition& Pin, FStrin
         default:
             // Log other types
             FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s has standard type %s"), 
-                *Pin.ID, *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type))), EN2CLogSeverity::Debug);
+                *Pin.Name, *StaticEnum<EN2CPinType>()->GetNameStringByValue(static_cast<int64>(Pin.Type))), EN2CLogSeverity::Debug);
             break;
     }
 
@@ -162,7 +154,7 @@ bool FN2CPinValidator::ValidateContainerFlags(const FN2CPinDefinition& Pin, FStr
     // Validate container flags - only one container type allowed
     if ((Pin.bIsArray && Pin.bIsMap) || (Pin.bIsArray && Pin.bIsSet) || (Pin.bIsMap && Pin.bIsSet))
     {
-        OutError = FString::Printf(TEXT("Pin validation warning: Pin %s has multiple container types"), *Pin.ID);
+        OutError = FString::Printf(TEXT("Pin validation warning: Pin %s has multiple container types"), *Pin.Name);
         FN2CLogger::Get().LogWarning(OutError);
         // Continue despite warning - LLM will need to determine the most appropriate container type
     }
@@ -171,7 +163,7 @@ bool FN2CPinValidator::ValidateContainerFlags(const FN2CPinDefinition& Pin, FStr
     if (Pin.bIsConst && Pin.bIsReference)
     {
         // Log this case but don't fail validation
-        FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s is both const and reference - this is valid for certain engine types"), *Pin.ID), EN2CLogSeverity::Debug);
+        FN2CLogger::Get().Log(FString::Printf(TEXT("Pin %s is both const and reference - this is valid for certain engine types"), *Pin.Name), EN2CLogSeverity::Debug);
     }
 
     return true;
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "N2CExtractCommandlet.generated.h"
+
+struct FAssetData;
+
+/**
+ * @class UN2CExtractCommandlet
+ * @brief Writes the N2C JSON of every Blueprint under a set of content paths
+ *
+ * Runs the node translator and serializer on each Blueprint without
+ * contacting any LLM provider, and writes one minified JSON file per asset.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=N2CExtract [-Paths=/Game/A+/Game/B] [-Output=<Dir>] [-BatchSize=32]
+ *
+ * Paths defaults to /Game and Output to Saved/NodeToCode/Extract. Each batch
+ * is requested from the async loader at once and flushed before it is
+ * translated on the game thread; serialization and file writes run on worker
+ * threads while the next batch loads. The Blueprint index is updated with
+ * every extracted Blueprint and saved at the end.
+ */
+UCLASS()
+class UN2CExtractCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UN2CExtractCommandlet();
+
+    // UCommandlet interface
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    /** Find every Blueprint under the given content paths */
+    void FindBlueprints(const TArray<FString>& ContentPaths, TArray<FAssetData>& OutAssets) const;
+
+    /** Output file for an asset, mirroring its package path */
+    static FString GetOutputFilePath(const FString& OutputDir, const FAssetData& Asset);
+};
@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Models/N2CBlueprint.h"
+
+class FN2CTranslationJob;
+class UBlueprint;
+class UPackage;
+class FObjectPostSaveContext;
+struct FAssetData;
+
+/**
+ * @class FN2CBlueprintIndex
+ * @brief Project-wide index of Blueprint graphs and the functions they call
+ *
+ * Built from raw translations of each Blueprint (see
+ * FN2CTranslationSession::SetRawGraphs), so every call node is seen under its
+ * original graph, whatever passes the user's translations run. Graphs are
+ * keyed as "<Class>.<Graph>", matching the MemberParent and MemberName of the
+ * CallFunction nodes that reference them, and interned to integer IDs with
+ * forward and reverse call lists so each hop of a call graph query is a
+ * single lookup. The index persists to Saved/NodeToCode/BlueprintIndex.json
+ * and, when enabled in the settings, is updated in the background whenever
+ * a Blueprint is saved or translated.
+ */
+class FN2CBlueprintIndex
+{
+public:
+    /** Indexed graph */
+    struct FGraphEntry
+    {
+        /** "<Class>.<Graph>" */
+        FString Key;
+
+        /** Package of the owning Blueprint, empty for functions that are only called */
+        FString Package;
+
+        /** Object path of the graph */
+        FString GraphPath;
+
+        /** FN2CGraph::BodyHash of the translated graph */
+        uint64 ContentHash = 0;
+
+        /** Graphs and functions this graph calls */
+        TArray<int32> Callees;
+
+        /** Graphs that call this graph or function */
+        TArray<int32> Callers;
+
+        /** Whether the graph itself is indexed, rather than only known as a call target */
+        bool IsIndexed() const { return !Package.IsEmpty(); }
+    };
+
+    /** Get the singleton instance */
+    static FN2CBlueprintIndex& Get();
+
+    /** Load the index and subscribe to save and removal events */
+    void Initialize();
+
+    /** Unsubscribe from all events and save the index if it changed */
+    void Shutdown();
+
+    /** Re-index a Blueprint in the background on a following tick */
+    void QueueBlueprint(UBlueprint* Blueprint);
+
+    /** Translate a Blueprint's raw graphs and re-index it now; returns whether it had graphs to translate */
+    bool IndexBlueprint(UBlueprint* Blueprint);
+
+    /** Drop every graph of a Blueprint package */
+    void RemovePackage(const FString& PackageName);
+
+    /** Find a graph or called function by key, or nullptr */
+    const FGraphEntry* FindGraph(const FString& Key) const;
+
+    /** Keys of the graphs and functions a graph calls directly */
+    void GetCallees(const FString& Key, TArray<FString>& OutKeys) const;
+
+    /** Keys of the graphs that call a graph or function directly */
+    void GetCallers(const FString& Key, TArray<FString>& OutKeys) const;
+
+    /** Keys of every indexed graph reachable through calls from a graph */
+    void GetTransitiveCallees(const FString& Key, TArray<FString>& OutKeys) const;
+
+    /** Keys of every indexed graph that reaches a graph or function through calls */
+    void GetTransitiveCallers(const FString& Key, TArray<FString>& OutKeys) const;
+
+    /** Load the index from disk, replacing the current contents */
+    bool Load();
+
+    /** Write the index to disk */
+    bool Save();
+
+    /** Number of indexed graphs */
+    int32 NumGraphs() const { return NumIndexed; }
+
+    /** Build a graph key */
+    static FString MakeKey(const FString& ClassName, const FString& GraphName);
+
+private:
+    /** Constructor */
+    FN2CBlueprintIndex() = default;
+
+    /** Replace the graphs of a Blueprint with the graphs of its raw translation */
+    void UpdateBlueprint(const UBlueprint* Blueprint, const FN2CBlueprint& N2CBlueprint);
+
+    /** Get the ID of a key, adding an unindexed entry if needed */
+    int32 FindOrAddGraph(const FString& Key);
+
+    /** Record a graph and its calls */
+    void AddGraph(const FString& Key, const FString& Package, const FString& GraphPath, uint64 ContentHash, const TArray<FString>& CalleeKeys);
+
+    /** Breadth-first walk over the forward or reverse call lists */
+    void GetReachable(const FString& Key, bool bCallees, TArray<FString>& OutKeys) const;
+
+    /** Path of the index file */
+    static FString GetIndexFilePath();
+
+    /** Queue saved Blueprints for re-indexing */
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+    /** Drop removed Blueprints */
+    void HandleAssetRemoved(const FAssetData& AssetData);
+
+    /** Start re-indexing the next queued Blueprint once the previous one is done */
+    bool Tick(float DeltaTime);
+
+    /** All known graphs and call targets */
+    TArray<FGraphEntry> Graphs;
+
+    /** Graph IDs by key */
+    TMap<FString, int32> GraphIds;
+
+    /** Indexed graph IDs by Blueprint package */
+    TMap<FString, TArray<int32>> PackageGraphs;
+
+    /** Saved and translated Blueprints waiting to be re-indexed */
+    TArray<TWeakObjectPtr<UBlueprint>> PendingBlueprints;
+
+    /** Quiet job translating the Blueprint being re-indexed */
+    TSharedPtr<FN2CTranslationJob> RefreshJob;
+
+    /** Number of indexed graphs */
+    int32 NumIndexed = 0;
+
+    /** Whether the index changed since it was loaded or saved */
+    bool bDirty = false;
+
+    /** Delegate handles */
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
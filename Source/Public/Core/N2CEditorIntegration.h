@@ -9,6 +9,10 @@
 #include "Utils/N2CLogger.h"
 #include "LLM/IN2CLLMService.h"
 
+class FN2CTranslationJob;
+class UN2CLLMModule;
+struct FN2CBlueprint;
+
 /**
  * @class FN2CEditorIntegration
  * @brief Handles integration with the Blueprint Editor
@@ -45,6 +49,9 @@ public:
     void RegisterBlueprintEditorCallback();
 
 private:
+    /** Translation started from a toolbar command, kept alive while it runs */
+    TSharedPtr<FN2CTranslationJob> ActiveJob;
+
     /** Map of Blueprint Editor instances to their command lists */
     TMap<TWeakPtr<FBlueprintEditor>, TSharedPtr<FUICommandList>> EditorCommandLists;
 
@@ -54,6 +61,27 @@ private:
     /** Execute collect nodes for a specific editor */
     void ExecuteCollectNodesForEditor(TWeakPtr<FBlueprintEditor> InEditor);
 
+    /** Execute translation of the selected nodes for a specific editor */
+    void ExecuteTranslateSelectionForEditor(TWeakPtr<FBlueprintEditor> InEditor);
+
+    /** Execute whole-Blueprint translation for a specific editor */
+    void ExecuteTranslateBlueprintForEditor(TWeakPtr<FBlueprintEditor> InEditor);
+
+    /** Whether a translation job is running or waiting on the LLM */
+    bool IsTranslationInProgress() const;
+
+    /** Start a job translating every graph of a Blueprint and submit the result */
+    void StartBlueprintTranslation(UBlueprint* BlueprintObj);
+
+    /** Queue a refresh of a translated Blueprint's entry in the Blueprint index, if the index is enabled */
+    void UpdateBlueprintIndex(UBlueprint* BlueprintObj);
+
+    /** Validate and serialize a translated Blueprint and send it to the LLM */
+    void SubmitTranslation(UN2CLLMModule* LLMModule, const FN2CBlueprint& Blueprint);
+
+    /** Send an already serialized Blueprint to the LLM */
+    void SubmitJson(UN2CLLMModule* LLMModule, const FN2CBlueprint& Blueprint, const FString& JsonOutput);
+
     /** Execute copy blueprint JSON to clipboard for a specific editor */
     void ExecuteCopyJsonForEditor(TWeakPtr<FBlueprintEditor> InEditor);
     
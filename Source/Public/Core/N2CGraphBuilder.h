@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/N2CGraphSnapshot.h"
+
+/**
+ * @class FN2CGraphBuilder
+ * @brief Builds FN2CGraph objects from immutable graph snapshots
+ *
+ * The builder never touches UObjects and never logs, so several builders can
+ * run concurrently on worker threads. Each builder owns its own pin lookup
+ * tables. Nodes and pins are referenced by index; textual IDs are left to
+ * FN2CSerializer.
+ */
+class FN2CGraphBuilder
+{
+public:
+    /**
+     * @brief Build all snapshots into graphs
+     * @param Snapshots Graph snapshots in discovery order
+     * @param OutGraphs Built graphs, in the same order as Snapshots
+     * @param bParallel Whether to build the graphs on worker threads
+     */
+    static void BuildGraphs(const TArray<FN2CGraphSnapshot>& Snapshots, TArray<FN2CGraph>& OutGraphs, bool bParallel);
+
+    /**
+     * @brief Construct a builder for a single snapshot
+     * @param InSnapshot Snapshot to build from, must outlive the builder
+     */
+    explicit FN2CGraphBuilder(const FN2CGraphSnapshot& InSnapshot);
+
+    /** Build the graph */
+    void Build(FN2CGraph& OutGraph);
+
+private:
+    /** Copy node definitions into the graph and index all pins */
+    void AddNodes(FN2CGraph& OutGraph);
+
+    /**
+     * Resolve every pin to the first non-knot pin reached through it.
+     * Knot chains are walked once and compressed, cycles resolve to INDEX_NONE.
+     */
+    void ResolveKnots();
+
+    /** Record execution and data flows between translated nodes */
+    void BuildFlows(FN2CGraph& OutGraph) const;
+
+    /** Get the resolved endpoint for a linked pin GUID, or INDEX_NONE */
+    int32 FindEndpoint(const FGuid& LinkedPinId) const;
+
+    /** Get the index of a pin within its node definition, or INDEX_NONE for hidden pins */
+    static int32 GetPinIndex(const FN2CNodeDefinition& NodeDef, const FN2CPinSnapshot& Pin);
+
+    /** Snapshot being built */
+    const FN2CGraphSnapshot& Snapshot;
+
+    /** Maps pin GUIDs to flat pin indices */
+    TMap<FGuid, int32> PinIndices;
+
+    /** Owning snapshot node of each flat pin */
+    TArray<int32> PinNodeIndices;
+
+    /** Flat pins in snapshot order */
+    TArray<const FN2CPinSnapshot*> Pins;
+
+    /** Flat index of the non-knot endpoint reached through each flat pin */
+    TArray<int32> ResolvedEndpoints;
+
+    /** Maps snapshot node indices to indices in the built graph, INDEX_NONE for knots */
+    TArray<int32> GraphNodeIndices;
+};
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+class UEdGraph;
+class UField;
+class UPackage;
+class FPackageReloadedEvent;
+enum class EPackageReloadPhase : uint8;
+
+/**
+ * @class FN2CGraphCache
+ * @brief Caches built dependency graphs between translations
+ *
+ * Nested graphs such as shared function libraries and macros are often pulled
+ * into many translations. Entries are keyed by the graph's object path and
+ * tagged with the change stamp of its package at the time it was snapshotted;
+ * any modification of an object in the package bumps the stamp, so a stale
+ * entry is never returned. Entries also remember the Blueprint types and
+ * nested graphs the graph references, so a cache hit pulls those in without
+ * walking the graph's nodes.
+ */
+class FN2CGraphCache
+{
+public:
+    /** Cached graph */
+    struct FEntry
+    {
+        /** Graph the entry was built from, guards against reloaded packages */
+        TWeakObjectPtr<const UEdGraph> Graph;
+
+        /** Change stamp of the graph's package when it was snapshotted */
+        uint32 PackageStamp = 0;
+
+        /** Built graph, before any graph passes */
+        TSharedPtr<const FN2CGraph, ESPMode::ThreadSafe> BuiltGraph;
+
+        /** Blueprint structs and enums referenced by the graph's nodes */
+        TArray<TWeakObjectPtr<UField>> ReferencedTypes;
+
+        /** Nested graphs referenced by the graph's nodes */
+        TArray<TWeakObjectPtr<UEdGraph>> ReferencedGraphs;
+    };
+
+    /** Get the singleton instance */
+    static FN2CGraphCache& Get();
+
+    /** Subscribe to modification and reload events */
+    void Initialize();
+
+    /** Unsubscribe from all events and clear the cache */
+    void Shutdown();
+
+    /** Find an up to date entry for a graph, or nullptr */
+    const FEntry* Find(const UEdGraph* Graph) const;
+
+    /** Store an entry; ignored if the graph's package changed since the entry's stamp was taken */
+    void Store(const UEdGraph* Graph, FEntry&& Entry);
+
+    /** Current change stamp of the package a graph lives in */
+    uint32 GetPackageStamp(const UEdGraph* Graph) const;
+
+    /** Drop all cached graphs */
+    void Clear();
+
+    /** Number of cached graphs */
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    /** Constructor */
+    FN2CGraphCache() = default;
+
+    /** Mark every graph in a package as changed */
+    void BumpPackage(const UPackage* Package);
+
+    /** Handle object modification */
+    void HandleObjectModified(UObject* Object);
+
+    /** Handle package reloads */
+    void HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+
+    /** Cached graphs keyed by object path */
+    TMap<FString, FEntry> Entries;
+
+    /** Last change stamp of every modified package, by package name */
+    TMap<FName, uint32> PackageStamps;
+
+    /** Last stamp handed out */
+    uint32 LastStamp = 0;
+
+    /** Delegate handles */
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PackageReloadedHandle;
+};
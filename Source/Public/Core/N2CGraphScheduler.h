@@ -0,0 +1,137 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+/**
+ * @struct FN2CScheduledGraph
+ * @brief A graph waiting to be translated
+ */
+struct FN2CScheduledGraph
+{
+    /** Graph to translate */
+    UEdGraph* Graph = nullptr;
+
+    /** Distance from the graph the translation started in */
+    int32 Depth = 0;
+
+    /** Estimated size of the graph in the translation payload, in tokens */
+    int32 EstimatedTokens = 0;
+};
+
+/**
+ * @class FN2CGraphScheduler
+ * @brief Breadth-first scheduler for graphs discovered during translation
+ *
+ * Graphs are deduplicated by object through a hashed visited set, and handed
+ * out level by level so every graph is translated at the shallowest depth it
+ * was reached from. Within a level the cheapest graphs come first, and graphs
+ * that would exceed the token budget are set aside so the payload stays within
+ * the model's context window.
+ */
+class FN2CGraphScheduler
+{
+public:
+    /**
+     * @brief Clear all state for a new translation
+     * @param InMaxDepth Deepest level that may be scheduled
+     * @param InTokenBudget Estimated token budget for the payload, 0 for unlimited
+     */
+    void Reset(int32 InMaxDepth, int32 InTokenBudget = 0);
+
+    /**
+     * @brief Mark a graph as visited without queueing it
+     * @param Graph Graph that is translated outside the scheduler
+     * @return True if the graph had not been seen before
+     */
+    bool MarkVisited(const UEdGraph* Graph);
+
+    /** Whether a graph has already been visited or queued */
+    bool IsVisited(const UEdGraph* Graph) const { return Visited.Contains(Graph); }
+
+    /** Whether a graph discovered from the given depth would exceed the depth limit */
+    bool ExceedsMaxDepth(int32 ParentDepth) const { return ParentDepth + 1 > MaxDepth; }
+
+    /**
+     * @brief Queue a graph one level below its parent
+     * @param Graph Discovered graph
+     * @param ParentDepth Depth of the graph that referenced it
+     * @return True if the graph was queued, false if it was already seen or too deep
+     */
+    bool Enqueue(UEdGraph* Graph, int32 ParentDepth);
+
+    /**
+     * @brief Take the next graph that fits the token budget
+     *
+     * Graphs that do not fit are recorded and skipped; a smaller graph later
+     * in the queue may still fit.
+     * @param OutGraph Receives the next graph
+     * @return False once the queue is empty
+     */
+    bool Dequeue(FN2CScheduledGraph& OutGraph);
+
+    /** Charge tokens for a graph translated outside the scheduler */
+    void ConsumeTokens(int32 Tokens) { UsedTokens += Tokens; }
+
+    /** Number of graphs still waiting */
+    int32 NumPending() const { return Queue.Num(); }
+
+    /** Number of graphs scheduled since the last reset, including dequeued ones */
+    int32 NumScheduled() const { return NumEnqueued; }
+
+    /** Sum of the token estimates of all scheduled graphs */
+    int64 GetTotalEstimatedTokens() const { return TotalEstimatedTokens; }
+
+    /** Tokens charged so far */
+    int64 GetUsedTokens() const { return UsedTokens; }
+
+    /** Token budget, 0 if unlimited */
+    int32 GetTokenBudget() const { return TokenBudget; }
+
+    /** Deepest level that has been scheduled */
+    int32 GetDeepestLevel() const { return DeepestLevel; }
+
+    /** Graphs left out because they did not fit the token budget */
+    const TArray<FN2CScheduledGraph>& GetOverBudgetGraphs() const { return OverBudgetGraphs; }
+
+    /** Estimate the size of a graph in the translation payload, in tokens */
+    static int32 EstimateTokens(const UEdGraph* Graph);
+
+    /** Estimate the size of an editor node in the translation payload, in tokens */
+    static int32 EstimateTokens(const UEdGraphNode* Node);
+
+    /** Estimate the size of a single node in the translation payload, in tokens */
+    static int32 EstimateNodeTokens(int32 NumVisiblePins);
+
+private:
+    /** Graphs already translated or queued */
+    TSet<const UEdGraph*> Visited;
+
+    /** Pending graphs, a heap ordered by depth and then estimated tokens */
+    TArray<FN2CScheduledGraph> Queue;
+
+    /** Graphs left out because they did not fit the token budget */
+    TArray<FN2CScheduledGraph> OverBudgetGraphs;
+
+    /** Deepest level that may be scheduled */
+    int32 MaxDepth = 0;
+
+    /** Token budget, 0 if unlimited */
+    int32 TokenBudget = 0;
+
+    /** Tokens charged so far */
+    int64 UsedTokens = 0;
+
+    /** Number of graphs scheduled since the last reset */
+    int32 NumEnqueued = 0;
+
+    /** Deepest level that has been scheduled */
+    int32 DeepestLevel = 0;
+
+    /** Sum of the token estimates of all scheduled graphs */
+    int64 TotalEstimatedTokens = 0;
+};
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+/**
+ * @struct FN2CPinSnapshot
+ * @brief Immutable copy of a single pin and its links
+ *
+ * Captured on the game thread so that flows can be resolved without
+ * touching UEdGraphPin objects.
+ */
+struct FN2CPinSnapshot
+{
+    /** Editor GUID of the pin */
+    FGuid PinId;
+
+    /** Index into the owning definition's InputPins/OutputPins, INDEX_NONE for hidden pins */
+    int32 DefinitionIndex = INDEX_NONE;
+
+    /** Whether this is an input pin */
+    bool bIsInput = false;
+
+    /** Whether this is an execution pin */
+    bool bIsExec = false;
+
+    /** GUIDs of all pins this pin is linked to */
+    TArray<FGuid> LinkedPinIds;
+};
+
+/**
+ * @struct FN2CNodeSnapshot
+ * @brief Immutable copy of a single node
+ *
+ * Holds the fully processed node definition (minus IDs, which are assigned
+ * when the graph is built) along with the node's pins in their original order.
+ */
+struct FN2CNodeSnapshot
+{
+    /** Editor GUID of the node */
+    FGuid NodeGuid;
+
+    /** Knot nodes are kept only so connections can be traced through them */
+    bool bIsKnot = false;
+
+    /** Processed node definition without node or pin IDs */
+    FN2CNodeDefinition Definition;
+
+    /** All pins of the node in UEdGraphNode::Pins order */
+    TArray<FN2CPinSnapshot> Pins;
+};
+
+/**
+ * @struct FN2CGraphSnapshot
+ * @brief Immutable copy of a UEdGraph used as input for FN2CGraphBuilder
+ */
+struct FN2CGraphSnapshot
+{
+    /** Graph name */
+    FString Name;
+
+    /** Graph type */
+    EN2CGraphType GraphType = EN2CGraphType::EventGraph;
+
+    /** Snapshotted nodes in collection order */
+    TArray<FN2CNodeSnapshot> Nodes;
+
+    /** Graph reused from an earlier translation; when set, Nodes is empty and the graph is copied as is */
+    TSharedPtr<const FN2CGraph, ESPMode::ThreadSafe> CachedGraph;
+
+    /** Number of nodes that will receive an ID (all non-knot nodes) */
+    int32 NumTranslatedNodes() const
+    {
+        int32 Count = 0;
+        for (const FN2CNodeSnapshot& Node : Nodes)
+        {
+            if (!Node.bIsKnot)
+            {
+                ++Count;
+            }
+        }
+        return Count;
+    }
+};
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/N2CGraphSnapshot.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * @class FN2CNodeCache
+ * @brief Caches node snapshots between translations
+ *
+ * Entries are keyed by NodeGuid and dropped whenever the node, or a node it
+ * is linked to, changes. Change tracking uses graph change notifications,
+ * Blueprint compilation events and object modification, so unchanged nodes
+ * are not re-extracted on the next translation.
+ */
+class FN2CNodeCache
+{
+public:
+    /** Get the singleton instance */
+    static FN2CNodeCache& Get();
+
+    /** Subscribe to object modification events */
+    void Initialize();
+
+    /** Unsubscribe from all events and clear the cache */
+    void Shutdown();
+
+    /**
+     * @brief Find a cached snapshot for a node
+     * @param Node Node to look up
+     * @return Cached snapshot, or nullptr if the node is not cached or dirty
+     */
+    const FN2CNodeSnapshot* Find(const UEdGraphNode* Node) const;
+
+    /**
+     * @brief Store a snapshot for a node and start watching its graph
+     * @param Node Node the snapshot was taken from
+     * @param Snapshot Snapshot to cache
+     */
+    void Store(const UEdGraphNode* Node, const FN2CNodeSnapshot& Snapshot);
+
+    /** Drop a node and its direct neighbours from the cache */
+    void InvalidateNode(const UEdGraphNode* Node);
+
+    /** Drop every node of a graph from the cache */
+    void InvalidateGraph(const UEdGraph* Graph);
+
+    /** Drop every node owned by a Blueprint from the cache */
+    void InvalidateBlueprint(const UBlueprint* Blueprint);
+
+    /** Drop all cached nodes and stop watching graphs */
+    void Clear();
+
+    /** Number of cached nodes */
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    /** Constructor */
+    FN2CNodeCache() = default;
+
+    /** Cached data for a single node */
+    struct FCacheEntry
+    {
+        /** Node the snapshot was taken from, guards against duplicated GUIDs */
+        TWeakObjectPtr<const UEdGraphNode> Node;
+
+        /** Graph that owned the node */
+        TWeakObjectPtr<const UEdGraph> Graph;
+
+        /** Blueprint that owned the node */
+        TWeakObjectPtr<const UBlueprint> Blueprint;
+
+        /** Nodes linked to this node when it was cached */
+        TArray<FGuid> LinkedNodeGuids;
+
+        /** Cached snapshot */
+        FN2CNodeSnapshot Snapshot;
+    };
+
+    /** Subscribe to change notifications for the node's graph and Blueprint */
+    void WatchNode(const UEdGraphNode* Node);
+
+    /** Handle graph change notifications */
+    void HandleGraphChanged(const FEdGraphEditAction& Action);
+
+    /** Handle Blueprint compilation */
+    void HandleBlueprintCompiled(UBlueprint* Blueprint);
+
+    /** Handle object modification, catches edits that do not notify the graph */
+    void HandleObjectModified(UObject* Object);
+
+    /** Cached entries keyed by NodeGuid */
+    TMap<FGuid, FCacheEntry> Entries;
+
+    /** Graphs with a registered change handler */
+    TMap<TWeakObjectPtr<UEdGraph>, FDelegateHandle> WatchedGraphs;
+
+    /** Blueprints with a registered compile handler */
+    TMap<TWeakObjectPtr<UBlueprint>, FDelegateHandle> WatchedBlueprints;
+
+    /** Handle for the object modified delegate */
+    FDelegateHandle ObjectModifiedHandle;
+};
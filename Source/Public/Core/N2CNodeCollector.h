@@ -29,6 +29,19 @@ public:
      */
     bool CollectNodesFromGraph(UEdGraph* Graph, TArray<UK2Node*>& OutNodes);
 
+    /**
+     * @brief Collects selected nodes and every node they transitively take data from
+     *
+     * Execution links are not followed, so only the exec edges between
+     * collected nodes end up in the translation. Reroute nodes are always
+     * collected so links through them can still be traced.
+     * @param Graph The graph the selection belongs to
+     * @param SelectedNodes Nodes selected in the graph editor
+     * @param[out] OutNodes Array to store collected nodes, in graph order
+     * @return True if at least one selected node could be collected
+     */
+    bool CollectSelectedNodes(UEdGraph* Graph, const FGraphPanelSelectionSet& SelectedNodes, TArray<UK2Node*>& OutNodes);
+
     /**
      * @brief Collects detailed pin information from a node
      * @param Node The node to collect pins from
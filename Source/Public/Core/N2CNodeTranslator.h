@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Models/N2CBlueprint.h"
+#include "Core/N2CGraphScheduler.h"
+#include "Core/N2CGraphSnapshot.h"
+#include "Core/N2CTranslationSession.h"
 #include "EdGraph/EdGraphNode.h"
 #include "Utils/Validators/N2CBlueprintValidator.h"
 #include "Utils/Processors/N2CNodeProcessor.h"
@@ -15,6 +18,12 @@
  *
  * Takes raw Blueprint nodes collected from the editor and translates them
  * into the structured FN2CBlueprint format for further processing.
+ * Translation runs in two phases: every graph is first snapshotted on the
+ * game thread, then FN2CGraphBuilder builds the graphs from those snapshots.
+ * The snapshot phase can be spread over several frames with StepSnapshots,
+ * which FN2CTranslationJob uses to keep the editor responsive. All state of
+ * a run lives in the FN2CTranslationSession passed to each call; the
+ * translator itself only keeps caches shared between runs.
  */
 class FN2CNodeTranslator
 {
@@ -24,78 +33,121 @@ public:
 
     /**
      * @brief Generate N2CStruct from collected nodes
+     * @param InSession Session that receives the result
      * @param CollectedNodes Array of nodes from the Blueprint Editor
      * @return True if translation succeeded
      */
-    bool GenerateN2CStruct(const TArray<UK2Node*>& CollectedNodes);
+    bool GenerateN2CStruct(FN2CTranslationSession& InSession, const TArray<UK2Node*>& CollectedNodes);
 
     /**
-     * @brief Get the generated Blueprint structure
-     * @return The translated Blueprint structure
+     * @brief Generate N2CStruct from every graph of a Blueprint
+     *
+     * Event graphs, functions, macros and delegate signatures are translated
+     * into a single FN2CBlueprint, sharing struct and enum extraction.
+     * @param InSession Session that receives the result
+     * @param Blueprint Blueprint to translate
+     * @return True if translation succeeded
      */
-    const FN2CBlueprint& GetN2CBlueprint() const { return N2CBlueprint; }
+    bool GenerateN2CStructForBlueprint(FN2CTranslationSession& InSession, UBlueprint* Blueprint);
 
-private:
-    /** Constructor */
-    FN2CNodeTranslator() = default;
+    /**
+     * @brief Start a resumable translation of collected nodes
+     *
+     * Nothing is snapshotted yet; call StepSnapshots until it returns true,
+     * build the graphs from TakeGraphSnapshots and pass them to
+     * CompleteTranslation. Dropping the session cancels the translation.
+     * @param InSession Fresh session to translate into
+     * @param CollectedNodes Array of nodes from the Blueprint Editor
+     * @return True if there is anything to translate
+     */
+    bool BeginNodeTranslation(FN2CTranslationSession& InSession, const TArray<UK2Node*>& CollectedNodes);
 
-    /** The Blueprint structure being built */
-    FN2CBlueprint N2CBlueprint;
+    /**
+     * @brief Start a resumable translation of every graph of a Blueprint
+     * @param InSession Fresh session to translate into
+     * @param Blueprint Blueprint to translate
+     * @return True if there is anything to translate
+     */
+    bool BeginBlueprintTranslation(FN2CTranslationSession& InSession, UBlueprint* Blueprint);
 
-    /** Current graph being processed */
-    FN2CGraph* CurrentGraph;
+    /**
+     * @brief Snapshot queued nodes until the time budget runs out
+     *
+     * Must be called on the game thread. Nodes deleted between steps are skipped.
+     * @param InSession Session being translated
+     * @param TimeBudgetSeconds Time to spend in this step
+     * @return True once every graph is snapshotted
+     */
+    bool StepSnapshots(FN2CTranslationSession& InSession, double TimeBudgetSeconds);
 
-    /** Maps node GUIDs to simplified IDs */
-    TMap<FGuid, FString> NodeIDMap;
+    /** Move out the finished graph snapshots of a session, in discovery order */
+    TArray<FN2CGraphSnapshot> TakeGraphSnapshots(FN2CTranslationSession& InSession);
 
-    /** Maps pin GUIDs to simplified IDs */
-    TMap<FGuid, FString> PinIDMap;
+    /**
+     * @brief Run the graph passes on built graphs and merge them into the session's Blueprint
+     * @param InSession Session being translated
+     * @param BuiltGraphs Graphs built from the snapshots, consumed by the merge
+     * @return True if translation succeeded
+     */
+    bool CompleteTranslation(FN2CTranslationSession& InSession, TArray<FN2CGraph>& BuiltGraphs);
 
-    /** Tracking sets to prevent duplicate processing */
-    TSet<FString> ProcessedStructPaths;
-    TSet<FString> ProcessedEnumPaths;
+private:
+    /** Constructor */
+    FN2CNodeTranslator() = default;
 
-    /** Struct to track graph processing information */
-    struct FGraphProcessInfo
-    {
-        UEdGraph* Graph;
-        int32 ParentDepth;
+    /** Session the current call works on */
+    FN2CTranslationSession* Session = nullptr;
 
-        FGraphProcessInfo(UEdGraph* InGraph, int32 InParentDepth)
-            : Graph(InGraph)
-            , ParentDepth(InParentDepth)
-        {}
-    };
+    /** Cleaned names keyed by raw name, shared across translations */
+    TMap<FName, FString> CleanNameCache;
+    
+    /** Set up a fresh session */
+    void BeginTranslation();
 
-    /** Queue of graphs to process with their parent depths */
-    TArray<FGraphProcessInfo> AdditionalGraphsToProcess;
+    /** Fill in the Blueprint metadata of the translation */
+    void CollectBlueprintMetadata(UBlueprint* Blueprint, UClass* BlueprintClass);
+
+    /** Snapshot queued graphs, build all snapshots and merge them into the session's Blueprint */
+    bool FinishTranslation(FN2CTranslationSession& InSession);
+
+    /** Log snapshot, type cache and schedule statistics once every graph is snapshotted */
+    void LogSnapshotSummary();
 
-    /** Current processing depth */
-    int32 CurrentDepth = 0;
-    
     /** Fallback method for processing node properties when no processor is available */
     void FallbackProcessNodeProperties(UK2Node* Node, FN2CNodeDefinition& OutNodeDef);
 
-    /** Process a single graph */
-    bool ProcessGraph(UEdGraph* Graph, EN2CGraphType GraphType);
+    /** Queue the nodes of a graph for snapshotting; it is kept only if it has translatable nodes */
+    void QueueGraphSnapshot(UEdGraph* Graph, int32 Depth);
+
+    /** Use the cached build of a dependency graph if it is up to date, pulling in its types and nested graphs */
+    bool SpliceCachedGraph(UEdGraph* Graph, int32 Depth);
+
+    /** Cache entry of the dependency graph being snapshotted, or nullptr */
+    FN2CGraphCache::FEntry* GetRecordingCacheEntry() const;
 
     /** Validate all flow references after processing */
     bool ValidateFlowReferences(FN2CGraph& Graph);
 
+    /** Run the IR passes enabled in the settings on built graphs */
+    void RunGraphPasses(TArray<FN2CGraph>& Graphs);
+
+    /** Replace every event graph with one graph per independent event chain */
+    void PartitionEventGraphs(TArray<FN2CGraph>& Graphs);
+
+    /** Point graphs whose body repeats an earlier graph's at that graph, so the body is serialized once */
+    void DeduplicateGraphs(FN2CBlueprint& Blueprint);
+
     /** Determine graph type from UEdGraph */
     EN2CGraphType DetermineGraphType(UEdGraph* Graph) const;
 
     /** Add a graph to be processed */
     void AddGraphToProcess(UEdGraph* Graph);
 
-    /** Generate a simplified node ID */
-    FString GenerateNodeID();
-
-    /** Generate a simplified pin ID scoped to the containing node */
-    FString GeneratePinID(int32 PinCount);
+    /** Convert a UK2Node to an immutable node snapshot */
+    bool SnapshotNode(UK2Node* Node, FN2CNodeSnapshot& OutSnapshot);
 
-    /** Convert a UK2Node to FN2CNodeDefinition */
-    bool ProcessNode(UK2Node* Node, FN2CNodeDefinition& OutNodeDef);
+    /** Copy the GUIDs of all pins linked to a pin */
+    void SnapshotPinLinks(const UEdGraphPin* Pin, FN2CPinSnapshot& OutPinSnapshot) const;
 
     /** Determine node type */
     void DetermineNodeType(UK2Node* Node, EN2CNodeType& OutType);
@@ -106,20 +158,11 @@ private:
     /** Convert UE pin type to N2C pin type */
     EN2CPinType DeterminePinType(const UEdGraphPin* Pin) const;
 
-    /** Follow pin connections through knot nodes to find the first non-knot target */
-    UEdGraphPin* TraceConnectionThroughKnots(UEdGraphPin* StartPin) const;
-
-    /** Initialize basic node processing and validation */
-    bool InitializeNodeProcessing(UK2Node* Node, FN2CNodeDefinition& OutNodeDef);
-
     /** Process node type and core properties */
     void ProcessNodeTypeAndProperties(UK2Node* Node, FN2CNodeDefinition& OutNodeDef);
 
-    /** Process all pins on the node */
-    void ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutNodeDef, TArray<UEdGraphPin*>& OutExecInputs, TArray<UEdGraphPin*>& OutExecOutputs);
-
-    /** Process execution and data flows for the node */
-    void ProcessNodeFlows(UK2Node* Node, const TArray<UEdGraphPin*>& ExecInputs, const TArray<UEdGraphPin*>& ExecOutputs);
+    /** Process all pins on the node, recording their links for the build phase */
+    void ProcessNodePins(UK2Node* Node, FN2CNodeDefinition& OutNodeDef, TArray<FN2CPinSnapshot>& OutPins);
 
     /** Check if a struct is Blueprint-defined */
     bool IsBlueprintStruct(UScriptStruct* Struct) const;
@@ -133,8 +176,11 @@ private:
     /** Process a Blueprint enum into FN2CEnum */
     FN2CEnum ProcessBlueprintEnum(UEnum* Enum);
 
-    /** Process a struct member */
-    FN2CStructMember ProcessStructMember(FProperty* Property);
+    /** Process a struct member, recording any Blueprint structs and enums it references */
+    FN2CStructMember ProcessStructMember(FProperty* Property, TArray<UField*>& OutReferencedTypes);
+
+    /** Process referenced Blueprint structs and enums and add them to the Blueprint */
+    void AddReferencedTypes(const TArray<UField*>& ReferencedTypes);
 
     /** Convert FProperty type to N2C struct member type */
     EN2CStructMemberType ConvertPropertyToStructMemberType(FProperty* Property) const;
@@ -142,12 +188,18 @@ private:
     /** Clean up property names by removing numeric suffixes and GUIDs */
     FString CleanPropertyName(const FString& RawName) const;
 
+    /** Queue any user graphs referenced by a node (composites, macros, functions, delegates) */
+    void DiscoverNodeGraphs(UK2Node* Node);
+
     /** Process any struct or enum types used in a node */
     void ProcessRelatedTypes(UK2Node* Node, FN2CNodeDefinition& OutNodeDef);
 
     /** Remove SKEL_ prefix and _C suffix from class names */
     FString GetCleanClassName(const FString& InName);
 
+    /** Cleaned name for an object or subcategory name, cached since it only depends on the name */
+    const FString& GetCleanName(FName InName);
+
     /** Log detailed debug information about the node */
     void LogNodeDetails(const FN2CNodeDefinition& NodeDef);
 };
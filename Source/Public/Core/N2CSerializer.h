@@ -28,22 +28,47 @@ public:
     static void SetPrettyPrint(bool bEnabled);
     static void SetIndentLevel(int32 Level);
 
+    /** Whether JSON output is pretty-printed */
+    static bool IsPrettyPrint() { return bPrettyPrint; }
+
+    /** Length of a graph's condensed JSON, used to measure what graph passes save */
+    static int32 GetCondensedGraphSize(const FN2CGraph& Graph);
+
 private:
-    /** Internal JSON conversion helpers */
+    /**
+     * Internal JSON conversion helpers.
+     * Nodes and pins are referenced by index in the IR; their textual IDs ("N1", "P1")
+     * are rendered here. Node IDs are numbered across all graphs starting at NodeIDBase + 1,
+     * pin IDs are local to their node (inputs first, then outputs).
+     */
     static TSharedPtr<FJsonObject> BlueprintToJsonObject(const FN2CBlueprint& Blueprint);
-    static TSharedPtr<FJsonObject> GraphToJsonObject(const FN2CGraph& Graph);
-    static TSharedPtr<FJsonObject> NodeToJsonObject(const FN2CNodeDefinition& Node);
-    static TSharedPtr<FJsonObject> PinToJsonObject(const FN2CPinDefinition& Pin);
-    static TSharedPtr<FJsonObject> FlowsToJsonObject(const FN2CFlows& Flows);
+    static TSharedPtr<FJsonObject> GraphToJsonObject(const FN2CGraph& Graph, int32 NodeIDBase);
+    static TSharedPtr<FJsonObject> NodeToJsonObject(const FN2CNodeDefinition& Node, int32 NodeIndex, int32 NodeIDBase);
+    static TSharedPtr<FJsonObject> PinToJsonObject(const FN2CPinDefinition& Pin, int32 PinIndex);
+    static TSharedPtr<FJsonObject> FlowsToJsonObject(const FN2CGraph& Graph, int32 NodeIDBase);
     static TSharedPtr<FJsonObject> StructToJsonObject(const FN2CStruct& Struct);
     static TSharedPtr<FJsonObject> EnumToJsonObject(const FN2CEnum& Enum);
 
+    /**
+     * Render textual node and pin references.
+     * MakeNodeID turns a node index into "N<NodeIDBase + index + 1>", MakePinRef
+     * appends the node-local pin ID, e.g. "N3.P2".
+     */
+    static FString MakeNodeID(int32 NodeIndex, int32 NodeIDBase);
+    static FString MakePinRef(int32 NodeIndex, int32 PinIndex, int32 NodeIDBase);
+
     /** JSON parsing helpers */
     static bool ParseBlueprintFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CBlueprint& OutBlueprint);
     static bool ParseGraphFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CGraph& OutGraph);
-    static bool ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CNodeDefinition& OutNode);
-    static bool ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CPinDefinition& OutPin);
-    static bool ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CFlows& OutFlows);
+    static bool ParseNodeFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CNodeDefinition& OutNode,
+        FString& OutNodeID, TMap<FString, int32>& OutPinIndices);
+    static bool ParsePinFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CPinDefinition& OutPin, FString& OutPinID);
+    static bool ParseFlowsFromJson(const TSharedPtr<FJsonObject>& JsonObject, const TMap<FString, int32>& NodeIndices,
+        const TArray<TMap<FString, int32>>& NodePinIndices, FN2CFlows& OutFlows);
+
+    /** Resolve a textual "N1.P2" reference to node and pin indices */
+    static bool ParsePinRef(const FString& PinRef, const TMap<FString, int32>& NodeIndices,
+        const TArray<TMap<FString, int32>>& NodePinIndices, int32& OutNodeIndex, int32& OutPinIndex);
     static bool ParseStructFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CStruct& OutStruct);
     static bool ParseEnumFromJson(const TSharedPtr<FJsonObject>& JsonObject, FN2CEnum& OutEnum);
 
@@ -467,10 +467,95 @@ public:
         meta=(DisplayName="Target Language"))
     EN2CCodeLanguage TargetLanguage = EN2CCodeLanguage::Cpp;
 
-    /** Maximum depth for nested graph translation (0 = No nested translation). This setting can greatly impact costs and context window utilization, so be mindful! */
+    /** Maximum depth for nested graph translation (0 = No nested translation). This setting can greatly impact costs and context window utilization, so be mindful! With the token budget enabled, nested graphs are also limited by their estimated size */
     UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
-        meta=(DisplayName="Max Translation Depth", ClampMin="0", ClampMax="5", UIMin="0", UIMax="5"))
+        meta=(DisplayName="Max Translation Depth", ClampMin="0", ClampMax="10", UIMin="0", UIMax="10"))
     int32 TranslationDepth = 0;
+
+    /** Stop expanding nested graphs once the estimated payload reaches the token budget, in addition to the depth limit. Graphs left out are reported in the log */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Limit Nested Graphs by Token Budget"))
+    bool bUseTokenBudget = true;
+
+    /** Estimated token budget for the translation payload (0 = half of the active model's context window) */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Translation Token Budget", ClampMin="0", EditCondition="bUseTokenBudget"))
+    int32 TranslationTokenBudget = 0;
+
+    /** Remove nodes that execution never reaches and that feed no reachable node before sending the graph */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Prune Unreachable Nodes"))
+    bool bPruneUnreachableNodes = false;
+
+    /** Fold trees of pure function calls and variable gets into single expression nodes, e.g. "(A + B) * C" */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Fold Pure Expressions"))
+    bool bFoldPureExpressions = false;
+
+    /** Send each independent event chain of an event graph, such as BeginPlay or an input event with everything it runs, as its own graph */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Split Event Graphs by Event"))
+    bool bPartitionEventGraphs = false;
+
+    /** Order nodes and flows by execution and structure instead of editor order, so the same logic always serializes the same way */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Canonical Node Order"))
+    bool bCanonicalNodeOrder = true;
+
+    /** Serialize graphs with identical nodes and flows, such as pasted copies of a collapsed graph, only once */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Deduplicate Identical Graphs"))
+    bool bDeduplicateGraphs = true;
+
+    /** Leave out default values of unconnected input pins that equal their type's zero value */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Strip Zero Default Values"))
+    bool bStripZeroDefaultValues = false;
+
+    /** Leave out unconnected Target pins of nodes that act on self */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Prune Self Target Pins"))
+    bool bPruneSelfTargetPins = false;
+
+    /** Leave out execution pins that are not linked, such as an unused Branch output */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Prune Unlinked Exec Pins"))
+    bool bPruneUnlinkedExecPins = false;
+
+    /** Build translated graphs on worker threads after they have been snapshotted on the game thread */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Parallel Graph Build"))
+    bool bParallelGraphBuild = true;
+
+    /** Game thread time spent snapshotting nodes per editor frame while translating; 0 translates in a single frame */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Translation Time Slice (ms)", ClampMin="0", UIMin="0", UIMax="50"))
+    float TranslationTimeSliceMs = 8.0f;
+
+    /** Translate and serialize a Blueprint in the background when its editor opens or it is compiled, so translating the whole Blueprint goes straight to the LLM. Edits discard the prepared result. Needs a translation time slice */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Speculative Translation"))
+    bool bSpeculativeTranslation = false;
+
+    /** Reuse extracted nodes between translations; only nodes that changed since the last translation (and their neighbours) are re-extracted */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Enable Node Cache"))
+    bool bEnableNodeCache = true;
+
+    /** Reuse extracted Blueprint struct and enum definitions until the type is modified, saved or reloaded */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Enable Type Cache"))
+    bool bEnableTypeCache = true;
+
+    /** Reuse built nested graphs, such as shared function libraries and macros, until their package is modified */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Enable Graph Cache"))
+    bool bEnableGraphCache = true;
+    
+    /** Keep a project-wide index of Blueprint graphs and their function calls, updated whenever a Blueprint is saved */
+    UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Code Generation",
+        meta=(DisplayName="Maintain Blueprint Index", ConfigRestartRequired=true))
+    bool bMaintainBlueprintIndex = false;
     
     /** Minimum severity level for logging */
     UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Node to Code | Logging")
@@ -482,6 +567,12 @@ public:
     /** Get the model for the selected provider */
     FString GetActiveModel() const;
 
+    /** Get the context window of the selected model, in tokens */
+    int32 GetActiveContextWindow() const;
+
+    /** Get the token budget for a translation payload, 0 if unlimited */
+    int32 GetTranslationTokenBudget() const;
+
     /** Get the minimum severity level for logging */
     EN2CLogSeverity GetMinLogSeverity() const { return MinSeverity; }
 
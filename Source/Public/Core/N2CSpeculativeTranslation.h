@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Models/N2CBlueprint.h"
+
+class FN2CTranslationJob;
+class FN2CTranslationSession;
+class UBlueprint;
+class UPackage;
+struct FPropertyChangedEvent;
+
+/** Called when a claimed translation is available, or with bReady false if it was invalidated before it finished */
+DECLARE_DELEGATE_ThreeParams(FOnN2CSpeculationClaimed, bool /*bReady*/, const FN2CBlueprint& /*Blueprint*/, const FString& /*JsonOutput*/);
+
+/**
+ * @class FN2CSpeculativeTranslation
+ * @brief Prepares the whole-Blueprint translation of the open Blueprint in the background
+ *
+ * When a Blueprint editor opens or its Blueprint is compiled, the Blueprint
+ * is translated by a quiet translation job and serialized, so translating it
+ * later goes straight to the LLM. Any modification of an object in a package
+ * the translation read, such as the Blueprint's own, a function library
+ * whose graphs were nested in or a Blueprint struct, cancels the job and
+ * drops the prepared result, as does any change to the plugin settings; the
+ * next compile prepares it again. Only the most recently opened Blueprint is
+ * kept warm.
+ */
+class FN2CSpeculativeTranslation
+{
+public:
+    /** Get the singleton instance */
+    static FN2CSpeculativeTranslation& Get();
+
+    /** Subscribe to modification events */
+    void Initialize();
+
+    /** Cancel any running job and unsubscribe from all events */
+    void Shutdown();
+
+    /** Start preparing a Blueprint's translation if speculative translation is enabled */
+    void Prepare(UBlueprint* Blueprint);
+
+    /**
+     * Use the prepared translation of a Blueprint
+     *
+     * @param Blueprint The Blueprint to translate
+     * @param OnClaimed Called now if the translation is ready, or once the running job finishes
+     * @return False if nothing is prepared for the Blueprint; OnClaimed is not called then
+     */
+    bool Claim(UBlueprint* Blueprint, FOnN2CSpeculationClaimed OnClaimed);
+
+    /** Whether a claim is waiting for the running job or for its invalidation to be reported */
+    bool HasPendingClaim() const { return PendingClaim.IsBound() || InvalidatedClaim.IsBound(); }
+
+private:
+    /** Constructor */
+    FN2CSpeculativeTranslation() = default;
+
+    /** Cancel the running job and drop the prepared result */
+    void Invalidate();
+
+    /** Stop following the current Blueprint */
+    void Release();
+
+    /** Report the invalidation to a waiting claim once the edit that caused it has landed */
+    bool HandleInvalidatedClaim(float DeltaTime);
+
+    /** Validate and serialize the result of a finished job */
+    void HandleJobFinished(bool bSuccess, FN2CTranslationSession& Session);
+
+    /** Whether the prepared result, or the running job so far, read from a package */
+    bool DependsOnPackage(const UPackage* Package) const;
+
+    /** Invalidate the prepared result when a package it was read from changes */
+    void HandleObjectModified(UObject* Object);
+
+    /** Invalidate the prepared result when the settings that shaped it change */
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+    /** Prepare the Blueprint again once it compiled */
+    void HandleBlueprintCompiled(UBlueprint* CompiledBlueprint);
+
+    /** Blueprint being prepared */
+    TWeakObjectPtr<UBlueprint> Blueprint;
+
+    /** Job preparing the Blueprint */
+    TSharedPtr<FN2CTranslationJob> Job;
+
+    /** Cancelled jobs whose build has not returned yet */
+    TArray<TSharedPtr<FN2CTranslationJob>> RetiredJobs;
+
+    /** Prepared result */
+    bool bReady = false;
+    FN2CBlueprint N2CBlueprint;
+    FString JsonOutput;
+
+    /** Packages the prepared result was read from */
+    TSet<FName> PreparedPackages;
+
+    /** Claim waiting for the running job */
+    FOnN2CSpeculationClaimed PendingClaim;
+
+    /** Claim whose job was invalidated, told on the next tick so its fallback sees the edit */
+    FOnN2CSpeculationClaimed InvalidatedClaim;
+    FTSTicker::FDelegateHandle InvalidatedClaimHandle;
+
+    /** Delegate handles */
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
@@ -16,16 +16,24 @@ public:
     // Commands
     TSharedPtr<FUICommandInfo> OpenWindowCommand;
     TSharedPtr<FUICommandInfo> CollectNodesCommand;
+    TSharedPtr<FUICommandInfo> TranslateSelectionCommand;
+    TSharedPtr<FUICommandInfo> TranslateBlueprintCommand;
     TSharedPtr<FUICommandInfo> CopyJsonCommand;
 
     // Command names and labels
     static const FName CommandName_Open;
     static const FName CommandName_Collect;
+    static const FName CommandName_TranslateSelection;
+    static const FName CommandName_TranslateBlueprint;
     static const FName CommandName_CopyJson;
     static const FText CommandLabel_Open;
     static const FText CommandLabel_Collect;
+    static const FText CommandLabel_TranslateSelection;
+    static const FText CommandLabel_TranslateBlueprint;
     static const FText CommandLabel_CopyJson;
     static const FText CommandTooltip_Open;
     static const FText CommandTooltip_Collect;
+    static const FText CommandTooltip_TranslateSelection;
+    static const FText CommandTooltip_TranslateBlueprint;
     static const FText CommandTooltip_CopyJson;
 };
@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Core/N2CTranslationSession.h"
+
+class SNotificationItem;
+class UBlueprint;
+class UK2Node;
+
+/** Called on the game thread once a translation job finished, with whether it succeeded and the session holding the result */
+DECLARE_DELEGATE_TwoParams(FOnN2CTranslationJobFinished, bool /*bSuccess*/, FN2CTranslationSession& /*Session*/);
+
+/**
+ * @class FN2CTranslationJob
+ * @brief Runs the node translator without freezing the editor
+ *
+ * Nodes are snapshotted on the game thread within the per-frame time slice
+ * from the settings, the graphs are then built on a worker thread, and the
+ * result is merged into the translator back on the game thread. Progress is
+ * shown in a notification that also lets the user cancel. Each job owns its
+ * own translation session, so jobs can run side by side; the owner keeps the
+ * job alive while it runs.
+ */
+class FN2CTranslationJob : public TSharedFromThis<FN2CTranslationJob>
+{
+public:
+    /** Constructor */
+    FN2CTranslationJob(const FText& InLabel, FOnN2CTranslationJobFinished InOnFinished);
+
+    /** Start translating collected nodes */
+    bool StartNodeTranslation(const TArray<UK2Node*>& CollectedNodes);
+
+    /** Start translating every graph of a Blueprint */
+    bool StartBlueprintTranslation(UBlueprint* Blueprint);
+
+    /** Whether to show a progress notification; on by default, set before starting */
+    void SetShowNotification(bool bShow) { bShowNotification = bShow; }
+
+    /** Whether to keep the graphs as the editor has them, see FN2CTranslationSession::SetRawGraphs; set before starting */
+    void SetRawGraphs(bool bInRawGraphs) { bRawGraphs = bInRawGraphs; }
+
+    /** Whether a job is running, including a cancelled one whose build has not returned yet */
+    bool IsRunning() const { return Phase != EPhase::Idle; }
+
+    /** Session of the running job, or nullptr once it ended */
+    const FN2CTranslationSession* GetSession() const { return Session.Get(); }
+
+    /** Stop the running job; its finished callback is not called */
+    void Cancel();
+
+    /** Cancel the job and wait for its worker to return */
+    void Shutdown();
+
+private:
+    enum class EPhase : uint8
+    {
+        Idle,
+        Snapshot,
+        Build,
+        Cancelling
+    };
+
+    /** Start driving a translation the translator has begun */
+    bool Start(bool bBegun);
+
+    /** Advance the job by one frame */
+    bool Tick(float DeltaTime);
+
+    /** Hand the snapshots to a worker thread to build */
+    void StartBuild();
+
+    /** Merge the built graphs and report the result */
+    void Finish(TArray<FN2CGraph>& Graphs);
+
+    /** Stop ticking, close the notification and go idle */
+    void End(bool bSuccess);
+
+    /** Update the notification with the current progress */
+    void UpdateNotification(const FText& Status);
+
+    /** Current phase */
+    EPhase Phase = EPhase::Idle;
+
+    /** State of the translation, dropped when the job ends */
+    TUniquePtr<FN2CTranslationSession> Session;
+
+    /** Build running on a worker thread */
+    TFuture<void> BuildTask;
+
+    /** Graphs written by the build */
+    TSharedPtr<TArray<FN2CGraph>, ESPMode::ThreadSafe> BuiltGraphs;
+
+    /** Called once the job succeeded or failed */
+    FOnN2CTranslationJobFinished FinishedDelegate;
+
+    /** What is being translated, for the notification */
+    FText JobLabel;
+
+    /** Progress notification */
+    TSharedPtr<SNotificationItem> Notification;
+
+    /** Whether the job shows a progress notification */
+    bool bShowNotification = true;
+
+    /** Whether the job's sessions keep the graphs as the editor has them */
+    bool bRawGraphs = false;
+
+    /** Time the job started */
+    double StartTime = 0.0;
+
+    /** Whether the graphs are built on worker threads, decided when the job starts */
+    bool bParallelBuild = true;
+
+    /** Number of frames spent snapshotting */
+    int32 NumSnapshotFrames = 0;
+
+    /** Ticker handle */
+    FTSTicker::FDelegateHandle TickerHandle;
+};
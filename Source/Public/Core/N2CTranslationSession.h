@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/N2CGraphCache.h"
+#include "Core/N2CGraphScheduler.h"
+#include "Core/N2CGraphSnapshot.h"
+#include "Misc/MemStack.h"
+#include "Models/N2CBlueprint.h"
+
+class UEdGraph;
+class UK2Node;
+
+/**
+ * @class FN2CTranslationSession
+ * @brief Owns all state of one translation run
+ *
+ * FN2CNodeTranslator only holds caches shared between runs; everything a run
+ * builds up lives here and is released with the session. Several sessions
+ * can be in flight at once, e.g. an editor job and a Blueprint index refresh,
+ * as long as each is stepped on the game thread. Node lists and other
+ * transient per-node data are allocated from the session's arena and freed
+ * in one go when the session is destroyed.
+ */
+class FN2CTranslationSession
+{
+public:
+    FN2CTranslationSession() = default;
+    ~FN2CTranslationSession() = default;
+
+    FN2CTranslationSession(const FN2CTranslationSession&) = delete;
+    FN2CTranslationSession& operator=(const FN2CTranslationSession&) = delete;
+
+    /** The translated Blueprint; complete once the translation finished */
+    const FN2CBlueprint& GetN2CBlueprint() const { return N2CBlueprint; }
+
+    /** Move the translated Blueprint out of the session */
+    FN2CBlueprint TakeN2CBlueprint() { return MoveTemp(N2CBlueprint); }
+
+    /** Names of nested graphs left out to stay within the token budget */
+    const TArray<FString>& GetGraphsOverBudget() const { return GraphsOverBudget; }
+
+    /** Number of nodes snapshotted so far */
+    int32 GetNumNodesSnapshotted() const { return NumNodesSnapshotted; }
+
+    /** Number of nodes queued for snapshotting so far; grows as nested graphs are discovered */
+    int32 GetNumNodesQueued() const { return NumNodesQueued; }
+
+    /** Number of nodes whose snapshot was reused from the node cache */
+    int32 GetNodeCacheHits() const { return NodeCacheHits; }
+
+    /** Number of nodes that were extracted */
+    int32 GetNodeCacheMisses() const { return NodeCacheMisses; }
+
+    /**
+     * Keep each graph as the editor has it: no nested graphs from other
+     * Blueprints, and no graph passes, partitioning or deduplication. For
+     * readers of the graphs themselves, such as the Blueprint index, rather
+     * than the LLM. Set before the translation begins.
+     */
+    void SetRawGraphs(bool bInRawGraphs) { bRawGraphs = bInRawGraphs; }
+
+    /** Whether the graphs are kept as the editor has them */
+    bool HasRawGraphs() const { return bRawGraphs; }
+
+    /** Names of the packages whose graphs or types the translation has read so far */
+    const TSet<FName>& GetReadPackages() const { return ReadPackages; }
+
+private:
+    friend class FN2CNodeTranslator;
+
+    /** A graph whose nodes are being snapshotted */
+    struct FPendingGraph
+    {
+        /** Snapshot filled in as nodes are processed */
+        FN2CGraphSnapshot Snapshot;
+
+        /** Nodes to snapshot, in the session arena; weak since the graph can be edited between steps */
+        TWeakObjectPtr<UK2Node>* Nodes = nullptr;
+        int32 NumNodes = 0;
+
+        /** Index of the next node to snapshot */
+        int32 NextNode = 0;
+
+        /** Distance from the graph the translation started in */
+        int32 Depth = 0;
+
+        /** Keep the snapshot even if it has no translatable nodes */
+        bool bKeepIfEmpty = false;
+
+        /** Graph the nodes came from, set for dependency graphs that can be cached */
+        TWeakObjectPtr<const UEdGraph> CacheSource;
+
+        /** Cache entry recorded while the nodes are snapshotted */
+        FN2CGraphCache::FEntry CacheEntry;
+    };
+
+    /** A snapshotted dependency graph to cache once it is built */
+    struct FGraphCacheCandidate
+    {
+        /** Index of the graph in GraphSnapshots and the built graphs */
+        int32 SnapshotIndex = INDEX_NONE;
+
+        /** Graph the snapshot was taken from */
+        TWeakObjectPtr<const UEdGraph> Graph;
+
+        /** Entry to store, without the built graph */
+        FN2CGraphCache::FEntry Entry;
+    };
+
+    /** Allocate an empty node list in the arena */
+    TWeakObjectPtr<UK2Node>* AllocateNodeList(int32 Count);
+
+    /** Record that the translation read from an object's package */
+    void AddReadPackage(const UObject* Object);
+
+    /** Whether the graphs are kept as the editor has them */
+    bool bRawGraphs = false;
+
+    /** Arena for transient per-node data, released with the session */
+    FMemStackBase Arena;
+
+    /** The Blueprint structure being built */
+    FN2CBlueprint N2CBlueprint;
+
+    /** Snapshots of all graphs to translate, in discovery order */
+    TArray<FN2CGraphSnapshot> GraphSnapshots;
+
+    /** Graphs queued for snapshotting, and the one being processed */
+    TArray<FPendingGraph> PendingGraphs;
+    int32 NextPendingGraph = 0;
+
+    /** Progress of the translation */
+    int32 NumNodesSnapshotted = 0;
+    int32 NumNodesQueued = 0;
+
+    /** Time the snapshot phase started */
+    double SnapshotStartTime = 0.0;
+
+    /** Packages the translation read from */
+    TSet<FName> ReadPackages;
+
+    /** Tracking sets to prevent duplicate processing */
+    TSet<const UScriptStruct*> ProcessedStructs;
+    TSet<const UEnum*> ProcessedEnums;
+
+    /** Breadth-first queue of discovered graphs */
+    FN2CGraphScheduler GraphScheduler;
+
+    /** Dependency graphs to store in the graph cache once built */
+    TArray<FGraphCacheCandidate> GraphCacheCandidates;
+
+    /** Nested graphs left out to stay within the token budget */
+    TArray<FString> GraphsOverBudget;
+
+    /** Depth of the graph currently being snapshotted */
+    int32 CurrentDepth = 0;
+
+    /** Node cache statistics */
+    int32 NodeCacheHits = 0;
+    int32 NodeCacheMisses = 0;
+
+    /** Type cache statistics */
+    int32 TypeCacheHits = 0;
+    int32 TypeCacheMisses = 0;
+
+    /** Graph cache statistics */
+    int32 GraphCacheHits = 0;
+    int32 GraphCacheMisses = 0;
+};
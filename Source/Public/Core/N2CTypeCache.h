@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+#include "UObject/ObjectKey.h"
+
+class UEnum;
+class UField;
+class UPackage;
+class UScriptStruct;
+class FObjectPostSaveContext;
+class FPackageReloadedEvent;
+enum class EPackageReloadPhase : uint8;
+
+/**
+ * @class FN2CTypeCache
+ * @brief Caches Blueprint struct and enum definitions for the lifetime of the editor
+ *
+ * Entries are keyed by the type object and dropped when the type is modified
+ * or its package is saved or reloaded. Struct entries also remember the
+ * Blueprint types their members reference, so a cache hit can pull those in
+ * without walking the struct's properties again.
+ */
+class FN2CTypeCache
+{
+public:
+    /** Cached struct definition */
+    struct FStructEntry
+    {
+        /** Extracted definition */
+        FN2CStruct Definition;
+
+        /** Blueprint structs and enums referenced by the struct's members */
+        TArray<TWeakObjectPtr<UField>> ReferencedTypes;
+
+        /** Package the struct lives in */
+        FObjectKey Package;
+    };
+
+    /** Cached enum definition */
+    struct FEnumEntry
+    {
+        /** Extracted definition */
+        FN2CEnum Definition;
+
+        /** Package the enum lives in */
+        FObjectKey Package;
+    };
+
+    /** Get the singleton instance */
+    static FN2CTypeCache& Get();
+
+    /** Subscribe to modification, save and reload events */
+    void Initialize();
+
+    /** Unsubscribe from all events and clear the cache */
+    void Shutdown();
+
+    /** Find a cached struct, or nullptr */
+    const FStructEntry* FindStruct(const UScriptStruct* Struct) const;
+
+    /** Find a cached enum, or nullptr */
+    const FEnumEntry* FindEnum(const UEnum* Enum) const;
+
+    /**
+     * @brief Store an extracted struct
+     * @param Struct Struct the definition was extracted from
+     * @param Definition Extracted definition
+     * @param ReferencedTypes Blueprint types referenced by the struct's members
+     */
+    void StoreStruct(const UScriptStruct* Struct, const FN2CStruct& Definition, const TArray<UField*>& ReferencedTypes);
+
+    /** Store an extracted enum */
+    void StoreEnum(const UEnum* Enum, const FN2CEnum& Definition);
+
+    /** Drop every type that lives in a package */
+    void InvalidatePackage(const UPackage* Package);
+
+    /** Drop all cached types */
+    void Clear();
+
+    /** Number of cached types */
+    int32 Num() const { return Structs.Num() + Enums.Num(); }
+
+private:
+    /** Constructor */
+    FN2CTypeCache() = default;
+
+    /** Handle object modification, catches edits made in the struct and enum editors */
+    void HandleObjectModified(UObject* Object);
+
+    /** Handle package saves */
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+    /** Handle package reloads */
+    void HandlePackageReloaded(EPackageReloadPhase Phase, FPackageReloadedEvent* Event);
+
+    /** Cached structs keyed by struct object */
+    TMap<FObjectKey, FStructEntry> Structs;
+
+    /** Cached enums keyed by enum object */
+    TMap<FObjectKey, FEnumEntry> Enums;
+
+    /** Delegate handles */
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle PackageReloadedHandle;
+};
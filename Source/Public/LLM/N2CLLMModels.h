@@ -72,6 +72,12 @@ struct FN2CLLMModelUtils
     static FN2CDeepSeekPricing GetDeepSeekPricing(EN2CDeepSeekModel Model);
     static FN2CGeminiPricing GetGeminiPricing(EN2CGeminiModel Model);
 
+    /** Context window getters, in tokens */
+    static int32 GetContextWindow(EN2COpenAIModel Model);
+    static int32 GetContextWindow(EN2CAnthropicModel Model);
+    static int32 GetContextWindow(EN2CGeminiModel Model);
+    static int32 GetContextWindow(EN2CDeepSeekModel Model);
+
     /** System prompt support checks */
     static bool SupportsSystemPrompts(EN2COpenAIModel Model)
     {
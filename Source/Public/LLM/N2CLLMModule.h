@@ -30,9 +30,10 @@ public:
     /** Initialize module */
     bool Initialize();
 
-    /** Process N2C JSON through LLM */
+    /** Process N2C JSON through LLM; the source Blueprint is saved next to the translation */
     void ProcessN2CJson(
         const FString& JsonInput,
+        const FN2CBlueprint& SourceBlueprint,
         const FOnLLMResponseReceived& OnComplete
     );
 
@@ -97,6 +98,9 @@ private:
     UPROPERTY()
     FN2CLLMConfig Config;
 
+    /** Blueprint the pending request was serialized from */
+    FN2CBlueprint RequestBlueprint;
+
     /** System prompt manager */
     UPROPERTY()
     class UN2CSystemPromptManager* PromptManager;
@@ -72,6 +72,81 @@ struct FN2CMetadata
     FN2CMetadata() : Name(TEXT("")), BlueprintType(EN2CBlueprintType::Normal), BlueprintClass(TEXT("")) {}
 };
 
+/**
+ * @struct FN2CExecEdge
+ * @brief Execution connection between two nodes of the same graph
+ *
+ * Nodes are referenced by their index in FN2CGraph::Nodes. Textual IDs
+ * such as "N1" are only produced by the serializer.
+ */
+USTRUCT(BlueprintType)
+struct FN2CExecEdge
+{
+    GENERATED_BODY()
+
+    /** Index of the node the execution leaves from */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 SourceNode = INDEX_NONE;
+
+    /** Index of the node the execution enters */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 TargetNode = INDEX_NONE;
+
+    FN2CExecEdge() = default;
+
+    FN2CExecEdge(int32 InSourceNode, int32 InTargetNode)
+        : SourceNode(InSourceNode)
+        , TargetNode(InTargetNode)
+    {
+    }
+
+    bool operator==(const FN2CExecEdge& Other) const
+    {
+        return SourceNode == Other.SourceNode && TargetNode == Other.TargetNode;
+    }
+};
+
+/**
+ * @struct FN2CDataEdge
+ * @brief Data connection from an output pin to an input pin
+ *
+ * Nodes are referenced by their index in FN2CGraph::Nodes and pins by their
+ * index within the node (see FN2CNodeDefinition::GetPin).
+ */
+USTRUCT(BlueprintType)
+struct FN2CDataEdge
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 SourceNode = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 SourcePin = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 TargetNode = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 TargetPin = INDEX_NONE;
+
+    FN2CDataEdge() = default;
+
+    FN2CDataEdge(int32 InSourceNode, int32 InSourcePin, int32 InTargetNode, int32 InTargetPin)
+        : SourceNode(InSourceNode)
+        , SourcePin(InSourcePin)
+        , TargetNode(InTargetNode)
+        , TargetPin(InTargetPin)
+    {
+    }
+
+    bool operator==(const FN2CDataEdge& Other) const
+    {
+        return SourceNode == Other.SourceNode && SourcePin == Other.SourcePin
+            && TargetNode == Other.TargetNode && TargetPin == Other.TargetPin;
+    }
+};
+
 /**
  * @struct FN2CFlows 
  * @brief Contains all execution and data flow connections between nodes
@@ -81,13 +156,13 @@ struct FN2CFlows
 {
     GENERATED_BODY()
 
-    /** Execution array. Each entry is a chain like "N1->N2->N3" */
+    /** Execution connections, serialized as chains such as "N1->N2->N3", one string per straight run of edges */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
-    TArray<FString> Execution;
+    TArray<FN2CExecEdge> Execution;
 
-    /** Data connections: a mapping from "N1.P4" to "N2.P3" */
+    /** Data connections, serialized as a mapping from "N1.P4" to "N2.P3", or to an array of pins for fan-out */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
-    TMap<FString, FString> Data;
+    TArray<FN2CDataEdge> Data;
 
     FN2CFlows()
     {
@@ -292,6 +367,24 @@ enum class EN2CGraphType : uint8
     Enum           UMETA(DisplayName = "Enum")
 };
 
+/**
+ * @struct FN2CFoldedExpression
+ * @brief Nodes a graph pass folded into a single expression node
+ */
+USTRUCT(BlueprintType)
+struct FN2CFoldedExpression
+{
+    GENERATED_BODY()
+
+    /** Index of the expression node in FN2CGraph::Nodes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    int32 ExpressionNode = INDEX_NONE;
+
+    /** Definitions of the folded nodes, the expression's root first */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    TArray<FN2CNodeDefinition> SourceDefinitions;
+};
+
 /**
  * @struct FN2CGraph
  * @brief Represents a single graph within the Blueprint
@@ -317,6 +410,16 @@ struct FN2CGraph
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     FN2CFlows Flows;
 
+    /** Side table of nodes folded into expression nodes; not serialized */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
+    TArray<FN2CFoldedExpression> FoldedExpressions;
+
+    /** Merkle hash of the graph's type, node hashes and flows; written to JSON for graphs that duplicates refer to */
+    uint64 BodyHash = 0;
+
+    /** Index in FN2CBlueprint::Graphs of an identical graph whose body is serialized in place of this one's */
+    int32 DuplicateOf = INDEX_NONE;
+
     FN2CGraph()
         : GraphType(EN2CGraphType::EventGraph)
     {
@@ -326,6 +429,58 @@ struct FN2CGraph
     bool IsValid() const;
 };
 
+/**
+ * @struct FN2CDataFlowIndex
+ * @brief Data flows of a graph grouped by source pin, in compressed sparse row form
+ *
+ * Every pin of every node owns a row; the targets of a row are stored
+ * contiguously in edge order, so all edges leaving a pin, including fan-out
+ * to several inputs, are found in O(1) and the whole graph is walked in
+ * O(nodes + pins + edges). The index is a view of the graph at the time it
+ * was built and must be rebuilt after the graph changes.
+ */
+struct NODETOCODE_API FN2CDataFlowIndex
+{
+    /** Input pin a data flow leads to */
+    struct FTarget
+    {
+        int32 Node = INDEX_NONE;
+        int32 Pin = INDEX_NONE;
+    };
+
+    /** Build the index of a graph's data flows; edges whose source pin does not exist are skipped */
+    explicit FN2CDataFlowIndex(const FN2CGraph& Graph);
+
+    /** Row of a node's pin */
+    int32 GetRow(int32 Node, int32 Pin) const { return PinOffsets[Node] + Pin; }
+
+    /** Targets fed by a node's pin */
+    TArrayView<const FTarget> GetTargets(int32 Node, int32 Pin) const
+    {
+        const int32 Row = GetRow(Node, Pin);
+        return MakeArrayView(Targets.GetData() + RowOffsets[Row], RowOffsets[Row + 1] - RowOffsets[Row]);
+    }
+
+    /** First target of every row, plus the total number of targets */
+    TArrayView<const int32> GetRowOffsets() const { return RowOffsets; }
+
+    /** Targets of all rows */
+    TArrayView<const FTarget> GetAllTargets() const { return Targets; }
+
+    /** Number of indexed data flows */
+    int32 NumEdges() const { return Targets.Num(); }
+
+private:
+    /** First row of every node, plus the total number of rows */
+    TArray<int32> PinOffsets;
+
+    /** First target of every row, plus the total number of targets */
+    TArray<int32> RowOffsets;
+
+    /** Targets of all rows */
+    TArray<FTarget> Targets;
+};
+
 /**
  * @struct FN2CBlueprint
  * @brief Top-level container for Blueprint graph data
@@ -355,6 +510,9 @@ struct FN2CBlueprint
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     TArray<FN2CEnum> Enums;
 
+    /** Merkle hash of the metadata, graph names and hashes, structs and enums, set when the translation completes; not serialized */
+    uint64 Hash = 0;
+
     FN2CBlueprint()
     {
         // Version is automatically initialized to "1.0.0" by FN2CVersion constructor
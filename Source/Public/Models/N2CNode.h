@@ -178,10 +178,6 @@ struct FN2CNodeDefinition
 {
     GENERATED_BODY()
 
-    /** Short ID for node references (e.g. "N1") */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
-    FString ID;
-
     /** The specific node type for code generation */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     EN2CNodeType NodeType;
@@ -235,9 +231,23 @@ struct FN2CNodeDefinition
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     TArray<FN2CPinDefinition> OutputPins;
 
+    /** Merkle hash of the node and everything feeding its inputs, set when the translation completes; not serialized */
+    uint64 Hash = 0;
+
+    /** Total number of pins. Pins are indexed inputs first, then outputs */
+    int32 NumPins() const { return InputPins.Num() + OutputPins.Num(); }
+
+    /** Whether a pin index refers to an input pin */
+    bool IsInputPinIndex(int32 PinIndex) const { return PinIndex >= 0 && PinIndex < InputPins.Num(); }
+
+    /** Get a pin by its index within the node */
+    const FN2CPinDefinition& GetPin(int32 PinIndex) const
+    {
+        return PinIndex < InputPins.Num() ? InputPins[PinIndex] : OutputPins[PinIndex - InputPins.Num()];
+    }
+
     FN2CNodeDefinition()
-        : ID(TEXT(""))
-        , NodeType(EN2CNodeType::CallFunction)
+        : NodeType(EN2CNodeType::CallFunction)
         , Name(TEXT(""))
         , MemberParent(TEXT(""))
         , MemberName(TEXT(""))
@@ -71,10 +71,6 @@ struct FN2CPinDefinition
 {
     GENERATED_BODY()
 
-    /** Short local ID, e.g. "P1" */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
-    FString ID;
-
     /** The display name of the pin, e.g. "Exec", "Target", "DeltaTime" */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     FString Name;
@@ -120,9 +116,14 @@ struct FN2CPinDefinition
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Node to Code")
     bool bIsSet = false;
 
+    /** Whether this is the node's self target pin; not serialized */
+    bool bIsSelfTarget = false;
+
+    /** Whether the default value is the one the node generated for the pin; not serialized */
+    bool bHasAutogeneratedDefault = false;
+
     FN2CPinDefinition()
-        : ID(TEXT(""))
-        , Name(TEXT(""))
+        : Name(TEXT(""))
         , Type(EN2CPinType::Exec)
         , SubType(TEXT(""))
         , DefaultValue(TEXT(""))
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+/**
+ * @class FN2CGraphHasher
+ * @brief Structural hashing and comparison of translated graphs
+ *
+ * Only what ends up in the translation payload is considered. Hashes form a
+ * Merkle tree: a node's hash covers its serialized fields and the hashes of
+ * the nodes feeding its inputs, a graph's hash covers its type, node hashes
+ * and flows, and a Blueprint's hash covers its metadata, graph names and
+ * hashes, structs and enums. A graph's name is left out of its own hash, so
+ * pasted copies of a collapsed graph hash the same.
+ */
+class NODETOCODE_API FN2CGraphHasher
+{
+public:
+    /** Hash of a node's serialized fields, without its inputs */
+    static uint64 HashNodeContent(const FN2CNodeDefinition& Node);
+
+    /** Set the hashes of a graph's nodes and of the graph itself; returns the graph's hash */
+    static uint64 HashGraph(FN2CGraph& Graph);
+
+    /** Set the hashes of every graph, node and of the Blueprint itself; returns the Blueprint's hash */
+    static uint64 HashBlueprint(FN2CBlueprint& Blueprint);
+
+    /** Whether two graphs have the same type, nodes and flows */
+    static bool AreBodiesEqual(const FN2CGraph& A, const FN2CGraph& B);
+
+    /** Format a hash the way it is written to JSON */
+    static FString HashToString(uint64 Hash);
+
+    /** Parse a hash written by HashToString, 0 if invalid */
+    static uint64 HashFromString(const FString& HashString);
+
+private:
+    /** Hash of a node's serialized fields */
+    static uint64 HashNode(const FN2CNodeDefinition& Node, uint64 Seed);
+
+    /** Hash of a struct's serialized fields */
+    static uint64 HashStruct(const FN2CStruct& Struct, uint64 Seed);
+
+    /** Hash of an enum's serialized fields */
+    static uint64 HashEnum(const FN2CEnum& Enum, uint64 Seed);
+
+    /** Hash of a pin's serialized fields */
+    static uint64 HashPin(const FN2CPinDefinition& Pin, uint64 Seed);
+
+    /** Whether two nodes have the same serialized fields */
+    static bool AreNodesEqual(const FN2CNodeDefinition& A, const FN2CNodeDefinition& B);
+
+    /** Whether two pins have the same serialized fields */
+    static bool ArePinsEqual(const FN2CPinDefinition& A, const FN2CPinDefinition& B);
+};
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+/**
+ * @class FN2CGraphPartitioner
+ * @brief Splits event graphs into one graph per independent event chain
+ *
+ * An event graph usually holds many unrelated handlers that only share the
+ * Blueprint's members. Nodes connected through execution, or through data
+ * between impure nodes, directly or through pure nodes, form one chain;
+ * every chain that starts at an event becomes its own graph, named after
+ * that event. Pure nodes are copied into every chain that reads them. Nodes
+ * no chain needs stay in a graph under the original name. Node order and
+ * edge order are kept, so canonically ordered graphs stay canonical.
+ */
+class NODETOCODE_API FN2CGraphPartitioner
+{
+public:
+    /**
+     * Split a graph into its event chains
+     *
+     * @param Graph The graph to split
+     * @param OutGraphs Receives one graph per chain, then the remaining nodes if any
+     * @return True if the graph was split, false if it has fewer than two chains
+     */
+    static bool Partition(const FN2CGraph& Graph, TArray<FN2CGraph>& OutGraphs);
+
+private:
+    /** Copy the selected nodes of a graph, with the edges and folded expressions between them */
+    static void ExtractNodes(const FN2CGraph& Graph, const TBitArray<>& Selected, FN2CGraph& OutGraph);
+};
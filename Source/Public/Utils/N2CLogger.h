@@ -8,6 +8,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "Models/N2CLogging.h"
 
 /**
@@ -45,6 +46,9 @@ public:
     /** Set minimum severity level for logging */
     void SetMinSeverity(EN2CLogSeverity Severity);
 
+    /** Check whether messages of a severity are logged, to skip formatting them in hot paths */
+    bool IsSeverityEnabled(EN2CLogSeverity Severity) const { return Severity >= MinSeverity; }
+
     /** Enable/disable file logging */
     void EnableFileLogging(bool bEnable);
 
@@ -91,6 +95,9 @@ private:
     /** Collection of logged errors */
     TArray<FN2CError> LoggedErrors;
 
+    /** Guards the logged errors and the log file, messages may come from worker threads */
+    mutable FCriticalSection LogLock;
+
     /** Minimum severity level for logging */
     EN2CLogSeverity MinSeverity;
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Models/N2CNode.h"
 #include "K2Node.h"
+#include "UObject/ObjectKey.h"
 
 #include "K2Node_ActorBoundEvent.h"
 #include "K2Node_AddComponent.h"
@@ -139,6 +140,12 @@ public:
     
     /** Determine variable node type */
     EN2CNodeType DetermineVariableNodeType(const UK2Node_Variable* Node);
+
+    /** Get every loaded node class with an explicit class or class name mapping */
+    void GetMappedClasses(TArray<const UClass*>& OutClasses) const;
+
+    /** Forget the resolved class types so the next lookups resolve them again */
+    void ResetClassTypeCache() { ClassTypeCache.Reset(); }
     
 private:
     /** Constructor - initializes default mappings */
@@ -149,13 +156,29 @@ private:
     
     /** Mappings from class pointers to node types */
     TMap<const UClass*, EN2CNodeType> ClassMappings;
+
+    /** Class-determined part of a node's type */
+    struct FClassTypeInfo
+    {
+        /** Node type shared by every node of the class */
+        EN2CNodeType NodeType = EN2CNodeType::CallFunction;
+
+        /** Variable nodes are refined per node by DetermineVariableNodeType */
+        bool bIsVariableNode = false;
+    };
+
+    /** Resolved types per node class, filled on first use and reset when mappings change */
+    TMap<TObjectKey<UClass>, FClassTypeInfo> ClassTypeCache;
     
     /** Initialize default mappings */
     void InitializeDefaultMappings();
+
+    /** Resolve the class-determined part of the node type for a node class */
+    FClassTypeInfo ResolveClassType(const UClass* Class) const;
     
     /** Get base node type from class name (strips K2Node_ prefix) */
-    FString GetBaseNodeType(const FString& ClassName);
+    FString GetBaseNodeType(const FString& ClassName) const;
     
     /** Try to determine node type based on inheritance */
-    bool MapFromInheritance(const UK2Node* Node, EN2CNodeType& OutType);
+    bool MapFromInheritance(const UClass* Class, EN2CNodeType& OutType) const;
 };
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CCanonicalOrderPass
+ * @brief Puts a graph's nodes and edges in an order that only depends on its logic
+ *
+ * Nodes are snapshotted in the order the editor stores them, which changes
+ * when nodes are moved, deleted or pasted back even if the logic is the same.
+ * This pass walks execution from the entry points, emitting the pure nodes
+ * feeding a node right before it, and breaks ties between siblings by a
+ * structural key that covers each node and its neighbourhood. Edges are then
+ * sorted, so the same logic always serializes to the same bytes.
+ */
+class NODETOCODE_API FN2CCanonicalOrderPass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Canonical node ordering"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+
+private:
+    /** Structural key of every node, refined with its neighbours' keys so it does not depend on node order */
+    static TArray<uint64> ComputeNodeKeys(const FN2CGraph& Graph, const TArray<TArray<int32>>& DataSources,
+        const TArray<TArray<int32>>& ExecSuccessors, const TArray<TArray<int32>>& ExecPredecessors);
+};
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CDeadNodePass
+ * @brief Removes nodes that can never affect the translated code
+ *
+ * A node is kept if execution can reach it from an entry point (an event,
+ * function entry or tunnel entry), or if a kept node consumes one of its
+ * outputs. Everything else, such as disconnected experiments and pure nodes
+ * whose outputs feed nothing, is removed. Graphs without any entry point,
+ * like pure macros, are left untouched.
+ */
+class NODETOCODE_API FN2CDeadNodePass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Dead node pruning"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+
+    /** Whether execution can start at a node */
+    static bool IsExecRoot(const FN2CNodeDefinition& Node);
+};
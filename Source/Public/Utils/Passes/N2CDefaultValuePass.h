@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CDefaultValuePass
+ * @brief Removes default values that only restate the pin type's default
+ *
+ * An unconnected input pin without a default value reads as the zero value of
+ * its type. Values are only removed when they are both that zero value and
+ * the value the node generated for the pin, so a parameter whose declared
+ * default differs keeps its explicit value.
+ */
+class NODETOCODE_API FN2CDefaultValuePass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Default value stripping"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+
+private:
+    /** Whether a pin's default value is the zero value of its type */
+    static bool IsZeroValue(const FN2CPinDefinition& Pin);
+
+    /** Whether every numeric component of a value such as "(X=0.0,Y=0.0)" or "0, 0, 0" is zero */
+    static bool AreComponentsZero(const FString& Value);
+};
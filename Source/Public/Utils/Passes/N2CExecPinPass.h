@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CExecPinPass
+ * @brief Removes execution pins without links
+ *
+ * An unlinked exec output, such as the False branch of a Branch that does
+ * nothing, adds no behaviour. Unlinked exec inputs are only removed when
+ * another exec input of the node is linked, so a node that is never entered
+ * still shows as such.
+ */
+class NODETOCODE_API FN2CExecPinPass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Unlinked exec pruning"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+
+private:
+    /** Whether any exec input of a node is linked */
+    static bool HasLinkedExecInput(const FN2CNodeDefinition& Node);
+};
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CExpressionFoldPass
+ * @brief Folds trees of pure nodes into single expression nodes
+ *
+ * A pure function call or variable get whose only output feeds exactly one
+ * pin of another such node is folded into that node. Each resulting tree of
+ * two or more nodes becomes one MathExpression node named after the
+ * expression, e.g. "(A + B) * Dot_VectorVector(V1, V2)". Inputs linked from
+ * outside the tree become the expression node's input pins, simple literals
+ * are written inline, and the folded nodes are kept in the graph's
+ * FoldedExpressions side table.
+ */
+class NODETOCODE_API FN2CExpressionFoldPass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Pure expression folding"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+
+private:
+    /** State of the expression being built from one tree */
+    struct FExpressionBuilder
+    {
+        /** Input pins of the expression node */
+        TArray<FN2CPinDefinition> InputPins;
+
+        /** Names already given to input pins */
+        TSet<FString> UsedNames;
+
+        /** Folded nodes, root first */
+        TArray<int32> SourceNodes;
+
+        /** Comments of the folded nodes */
+        TArray<FString> Comments;
+    };
+
+    /** Whether a node can be part of an expression */
+    static bool IsFoldable(const FN2CNodeDefinition& Node);
+
+    /**
+     * Render a node and the nodes folded into it
+     *
+     * @param NodeIndex Node to render
+     * @param bOutInfix Set if the result is an infix operation that needs parentheses when nested
+     * @return The rendered expression
+     */
+    FString RenderNode(int32 NodeIndex, bool& bOutInfix);
+
+    /** Render one input of a node, adding an expression input pin if it comes from outside the tree */
+    FString RenderInput(int32 NodeIndex, int32 PinIndex);
+
+    /** Add an input pin to the expression node and return its unique name */
+    FString AddInputPin(const FN2CPinDefinition& Pin);
+
+    /** Infix operator of a math library node, or nullptr if the node is rendered as a call */
+    static const TCHAR* GetOperator(const FN2CNodeDefinition& Node, int32 NumArgs);
+
+    /** Literal for an unconnected pin that can be written inline, or an empty string */
+    static FString GetInlineLiteral(const FN2CPinDefinition& Pin);
+
+    /** Graph being folded */
+    FN2CGraph* Graph = nullptr;
+
+    /** Incoming data edge of every input pin, per node */
+    TArray<TArray<int32>> InputEdges;
+
+    /** Node each node is folded into, INDEX_NONE if it is not folded */
+    TArray<int32> FoldTarget;
+
+    /** Position of every folded input pin on its expression node, per node */
+    TArray<TArray<int32>> ExpressionPins;
+
+    /** Expression being built */
+    FExpressionBuilder* Builder = nullptr;
+};
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Models/N2CBlueprint.h"
+
+/**
+ * @struct FN2CGraphPassResult
+ * @brief What a graph pass changed
+ */
+struct FN2CGraphPassResult
+{
+    /** Nodes removed from the graph */
+    int32 NodesRemoved = 0;
+
+    /** Pins removed from the remaining nodes */
+    int32 PinsRemoved = 0;
+
+    /** Default values removed from the remaining pins */
+    int32 ValuesRemoved = 0;
+
+    /** Execution and data edges removed from the graph */
+    int32 EdgesRemoved = 0;
+
+    /** Estimated tokens removed from the translation payload */
+    int32 TokensSaved = 0;
+
+    /** Characters removed from the graph's condensed JSON, measured by the caller */
+    int32 BytesSaved = 0;
+
+    /** Accumulate another result */
+    FN2CGraphPassResult& operator+=(const FN2CGraphPassResult& Other)
+    {
+        NodesRemoved += Other.NodesRemoved;
+        PinsRemoved += Other.PinsRemoved;
+        ValuesRemoved += Other.ValuesRemoved;
+        EdgesRemoved += Other.EdgesRemoved;
+        TokensSaved += Other.TokensSaved;
+        BytesSaved += Other.BytesSaved;
+        return *this;
+    }
+};
+
+/**
+ * @class IN2CGraphPass
+ * @brief Interface for passes that transform a translated graph before serialization
+ *
+ * Passes run on the index-based IR after the graph has been built, so they
+ * never touch editor objects and may run on any thread.
+ */
+class NODETOCODE_API IN2CGraphPass
+{
+public:
+    /** Virtual destructor */
+    virtual ~IN2CGraphPass() {}
+
+    /** Name of the pass, used in logs */
+    virtual const TCHAR* GetName() const = 0;
+
+    /**
+     * Run the pass on a graph
+     *
+     * @param Graph The graph to transform in place
+     * @param OutResult Receives what the pass changed
+     * @return True if the graph was modified
+     */
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) = 0;
+};
+
+/**
+ * @class FN2CBaseGraphPass
+ * @brief Base implementation for graph passes
+ *
+ * Provides node and pin removal with index remapping so passes only have to
+ * decide what to keep.
+ */
+class NODETOCODE_API FN2CBaseGraphPass : public IN2CGraphPass
+{
+public:
+    /** Destructor */
+    virtual ~FN2CBaseGraphPass() {}
+
+protected:
+    /**
+     * Remove nodes from a graph and renumber the remaining ones
+     *
+     * Edges touching a removed node are dropped, all other edges and folded
+     * expressions are remapped to the new node indices.
+     *
+     * @param Graph The graph to compact
+     * @param KeepNodes One bit per node, set for the nodes to keep
+     * @param OutResult Receives the removed node, edge and token counts
+     */
+    static void RemoveNodes(FN2CGraph& Graph, const TBitArray<>& KeepNodes, FN2CGraphPassResult& OutResult);
+
+    /**
+     * Move a graph's nodes into a new order
+     *
+     * Edges and folded expressions are remapped to the new node indices.
+     *
+     * @param Graph The graph to reorder
+     * @param NewOrder Old index of the node at each new position; must be a permutation
+     */
+    static void ReorderNodes(FN2CGraph& Graph, const TArray<int32>& NewOrder);
+
+    /**
+     * Remove pins from a graph's nodes and renumber the remaining ones
+     *
+     * Data edges touching a removed pin are dropped, all other data edges are
+     * remapped to the new pin indices.
+     *
+     * @param Graph The graph to compact
+     * @param KeepPins One entry per node with one bit per pin, inputs first; empty to keep all pins of a node
+     * @param OutResult Receives the removed pin, edge and token counts
+     */
+    static void RemovePins(FN2CGraph& Graph, const TArray<TBitArray<>>& KeepPins, FN2CGraphPassResult& OutResult);
+
+    /**
+     * Remove every pin a predicate selects
+     *
+     * @param Graph The graph to compact
+     * @param ShouldRemove Called with the node, the pin and whether it is an input
+     * @param OutResult Receives the removed pin, edge and token counts
+     * @return True if any pin was removed
+     */
+    static bool RemovePinsIf(FN2CGraph& Graph,
+        TFunctionRef<bool(const FN2CNodeDefinition&, const FN2CPinDefinition&, bool)> ShouldRemove,
+        FN2CGraphPassResult& OutResult);
+
+    /** Estimate the size of a node in the translation payload, in tokens */
+    static int32 EstimateNodeTokens(const FN2CNodeDefinition& Node);
+};
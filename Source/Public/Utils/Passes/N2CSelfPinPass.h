@@ -0,0 +1,22 @@
+// Copyright (c) 2025 Nick McClure (Protospatial). All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/Passes/N2CGraphPass.h"
+
+/**
+ * @class FN2CSelfPinPass
+ * @brief Removes unconnected self target pins
+ *
+ * An unconnected Target pin without a default object means the node acts on
+ * self, which is what a call without a target reads as anyway. The owning
+ * class is still given by the node's member parent.
+ */
+class NODETOCODE_API FN2CSelfPinPass : public FN2CBaseGraphPass
+{
+public:
+    virtual const TCHAR* GetName() const override { return TEXT("Self target pruning"); }
+
+    virtual bool Run(FN2CGraph& Graph, FN2CGraphPassResult& OutResult) override;
+};